@@ -40,6 +40,7 @@
 #include "Saturation/ProvingHelper.hpp"
 
 #include "Kernel/Problem.hpp"
+#include "Kernel/Signature.hpp"
 
 #include "Schedules.hpp"
 
@@ -75,6 +76,13 @@ PortfolioMode::PortfolioMode() : _slowness(1.0), _syncSemaphore(2) {
   _syncSemaphore.set(SEM_PRINTED,0); // to indicate that a child has already printed result (it should only happen once)
 }
 
+PortfolioMode::~PortfolioMode()
+{
+  while (_sineSelectors.isNonEmpty()) {
+    delete _sineSelectors.pop();
+  }
+}
+
 /**
  * The function that does all the job: reads the input files and runs
  * Vampires to solve problems.
@@ -284,6 +292,8 @@ bool PortfolioMode::prepareScheduleAndPerform(const Shell::Property& prop)
     USER_ERROR("The schedule is empty.");
   }
 
+  precomputeSineSelections(schedule);
+
   return runScheduleAndRecoverProof(std::move(schedule));
 };
 
@@ -626,6 +636,102 @@ void PortfolioMode::runSlice(vstring sliceCode, int timeLimitInDeciseconds)
   }
 } // runSlice
 
+/**
+ * Return true if the preprocessing of @b opt would reach SInE selection
+ * with the problem exactly as it is in the portfolio master
+ */
+bool PortfolioMode::canUsePrecomputedSine(const Options& opt)
+{
+  CALL("PortfolioMode::canUsePrecomputedSine");
+
+  return opt.sineSelection() != Options::SineSelection::OFF &&
+    !opt.shuffleInput() &&
+    opt.guessTheGoal() == Options::GoalGuess::OFF &&
+    !opt.sineToAge() &&
+    !opt.useSineLevelSplitQueues() &&
+    opt.sineToPredLevels() == Options::PredicateSineLevels::OFF &&
+    opt.functionExtensionality() != Options::FunctionExtensionality::AXIOM &&
+    !opt.choiceAxiom();
+}
+
+/**
+ * Compute, in one go for all the slices of @b schedule, the SInE selections
+ * the slices would otherwise compute one by one
+ *
+ * Only done for problems on which the preprocessing steps before SInE
+ * selection do nothing.
+ */
+void PortfolioMode::precomputeSineSelections(const Schedule& schedule)
+{
+  CALL("PortfolioMode::precomputeSineSelections");
+
+  if (_prb->hasInterpretedOperations() || env.signature->hasTermAlgebras() ||
+      _prb->hasFOOL() || _prb->higherOrder() || env.signature->hasDistinctGroups() ||
+      env.options->guessTheGoal() != Options::GoalGuess::OFF) {
+    return;
+  }
+
+  Schedule::BottomFirstIterator it(schedule);
+  while (it.hasNext()) {
+    Options opt = *env.options;
+    // warnings about the slice are printed when the slice runs
+    opt.setIgnoreMissing(Options::IgnoreMissing::ON);
+    try {
+      opt.readFromEncodedOptions(it.next());
+    }
+    catch (Exception&) {
+      // the slice will report the problem itself
+      continue;
+    }
+    if (!canUsePrecomputedSine(opt)) {
+      continue;
+    }
+    bool onIncluded = opt.sineSelection() == Options::SineSelection::INCLUDED;
+    SineMultiSelector* selector = 0;
+    for (unsigned i = 0; i < _sineSelectors.size(); i++) {
+      if (_sineSelectors[i]->onIncluded() == onIncluded &&
+          _sineSelectors[i]->genThreshold() == opt.sineGeneralityThreshold()) {
+        selector = _sineSelectors[i];
+        break;
+      }
+    }
+    if (!selector) {
+      selector = new SineMultiSelector(onIncluded, opt.sineGeneralityThreshold());
+      _sineSelectors.push(selector);
+    }
+    selector->addVariant(opt.sineTolerance(), opt.sineDepth());
+  }
+
+  for (unsigned i = 0; i < _sineSelectors.size(); i++) {
+    _sineSelectors[i]->perform(_prb->units());
+  }
+}
+
+/**
+ * If the SInE selection of @b opt was precomputed, apply it to the problem
+ * and switch off SInE selection in @b opt
+ */
+void PortfolioMode::applyPrecomputedSineSelection(Options& opt)
+{
+  CALL("PortfolioMode::applyPrecomputedSineSelection");
+
+  if (!canUsePrecomputedSine(opt)) {
+    return;
+  }
+  bool onIncluded = opt.sineSelection() == Options::SineSelection::INCLUDED;
+  for (unsigned i = 0; i < _sineSelectors.size(); i++) {
+    SineMultiSelector* selector = _sineSelectors[i];
+    unsigned idx;
+    if (selector->onIncluded() == onIncluded &&
+        selector->genThreshold() == opt.sineGeneralityThreshold() &&
+        selector->findVariant(opt.sineTolerance(), opt.sineDepth(), idx)) {
+      selector->apply(idx, *_prb);
+      opt.setSineSelection(Options::SineSelection::OFF);
+      return;
+    }
+  }
+}
+
 /**
  * Run a slice given by its options
  */
@@ -648,11 +754,15 @@ void PortfolioMode::runSlice(Options& strategyOpt)
   opt.setNormalize(false);
   opt.setForcedOptionValues();
   opt.checkGlobalOptionConstraints();
+  // the printed strategy must be the one of the slice, SInE selection included
+  vstring strategyId = opt.testId();
+  applyPrecomputedSineSelection(opt);
+  ASS_EQ(opt.testId(), strategyId);
   *env.options = opt; //just temporarily until we get rid of dependencies on env.options in solving
 
   if (outputAllowed()) {
     env.beginOutput();
-    addCommentSignForSZS(env.out()) << opt.testId() << " on " << opt.problemName() << 
+    addCommentSignForSZS(env.out()) << strategyId << " on " << opt.problemName() << 
       " for (" << opt.timeLimitInDeciseconds() << "ds"<<
 #ifdef __linux__
       "/" << opt.instructionLimit() << "Mi" <<
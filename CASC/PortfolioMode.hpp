@@ -24,6 +24,7 @@
 #include "Lib/Sys/Semaphore.hpp"
 
 #include "Shell/Property.hpp"
+#include "Shell/SineUtils.hpp"
 #include "Schedules.hpp"
 
 namespace CASC
@@ -39,6 +40,7 @@ class PortfolioMode {
   };
 
   PortfolioMode();
+  ~PortfolioMode();
 public:
   static bool perform(float slowness);
 
@@ -57,6 +59,10 @@ private:
   [[noreturn]] void runSlice(vstring sliceCode, int remainingTime);
   [[noreturn]] void runSlice(Options& strategyOpt);
 
+  static bool canUsePrecomputedSine(const Options& opt);
+  void precomputeSineSelections(const Schedule& schedule);
+  void applyPrecomputedSineSelection(Options& opt);
+
 #if VDEBUG
   DHSet<pid_t> childIds;
 #endif
@@ -74,6 +80,12 @@ private:
    */
   ScopedPtr<Problem> _prb;
 
+  /**
+   * SInE selections computed in advance for the slices of the schedule,
+   * one selector for each selection mode and generality threshold used
+   */
+  Stack<SineMultiSelector*> _sineSelectors;
+
   Semaphore _syncSemaphore; // semaphore for synchronizing proof printing
 };
 
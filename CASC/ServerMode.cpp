@@ -0,0 +1,331 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ServerMode.cpp
+ * Implements class ServerMode.
+ */
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Lib/Portability.hpp"
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/System.hpp"
+#include "Debug/TimeProfiling.hpp"
+#include "Lib/Timer.hpp"
+#include "Lib/fdstream.hpp"
+
+#include "Lib/Sys/Multiprocessing.hpp"
+
+#include "Kernel/Problem.hpp"
+#include "Kernel/Unit.hpp"
+
+#include "Shell/Options.hpp"
+#include "Saturation/ProvingHelper.hpp"
+#include "Shell/Statistics.hpp"
+#include "Shell/UIHelper.hpp"
+
+#include "Parse/TPTP.hpp"
+
+#include "ServerMode.hpp"
+
+using namespace CASC;
+using namespace std;
+using namespace Lib;
+using namespace Lib::Sys;
+using namespace Saturation;
+
+void ServerMode::perform()
+{
+  CALL("ServerMode::perform");
+
+  vstring path = env.options->serverSocket();
+  if (path == "") {
+    USER_ERROR("server_socket must be specified for server mode");
+  }
+
+  ServerMode server;
+  // the time limit applies to the individual queries, the server runs until told to quit
+  server._queryTimeLimit = env.options->timeLimitInDeciseconds();
+  env.options->setTimeLimitInDeciseconds(0);
+
+  sockaddr_un addr;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    USER_ERROR("Socket path too long: "+path);
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path.c_str());
+
+  errno=0;
+  server._listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server._listenSocket == -1) {
+    SYSTEM_FAIL("Socket creation.", errno);
+  }
+  // a socket left behind by a previous server would make bind() fail
+  unlink(path.c_str());
+  if (bind(server._listenSocket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1 ||
+      listen(server._listenSocket, 16) == -1) {
+    SYSTEM_FAIL("Binding socket "+path+".", errno);
+  }
+
+  env.beginOutput();
+  env.out() << "% Server listening on " << path << endl;
+  env.endOutput();
+
+  bool running = true;
+  while (running) {
+    int connection = accept(server._listenSocket, 0, 0);
+    if (connection == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      SYSTEM_FAIL("Accepting connection.", errno);
+    }
+    fdstream* stream;
+    {
+      BYPASSING_ALLOCATOR;
+      stream = new fdstream(connection);
+    }
+    running = server.serve(*stream, *stream, connection);
+    {
+      BYPASSING_ALLOCATOR;
+      delete stream;
+    }
+    close(connection);
+  }
+
+  close(server._listenSocket);
+  unlink(path.c_str());
+} // ServerMode::perform
+
+/**
+ * Execute the commands coming from a connection until it is closed.
+ * Return false if the server should stop.
+ */
+bool ServerMode::serve(istream& in, ostream& out, int connection)
+{
+  CALL("ServerMode::serve");
+
+  vstring line;
+  while (getline(in, line)) {
+    vistringstream words(line);
+    vstring cmd;
+    if (!(words >> cmd)) {
+      continue;
+    }
+
+    if (cmd == "quit") {
+      out << "ok" << endl;
+      return false;
+    }
+    if (cmd == "library") {
+      vstring name;
+      Stack<vstring> files;
+      vstring file;
+      words >> name;
+      while (words >> file) {
+        files.push(file);
+      }
+      if (files.isEmpty()) {
+        out << "error usage: library <name> <file>..." << endl;
+        continue;
+      }
+      loadLibrary(name, files, out);
+      continue;
+    }
+    if (cmd == "prove") {
+      vstring name, problemFile, limit;
+      int timeLimit = _queryTimeLimit;
+      if (!(words >> name >> problemFile) ||
+          ((words >> limit) && !Int::stringToInt(limit, timeLimit))) {
+        out << "error usage: prove <library> <file> [deciseconds]" << endl;
+        continue;
+      }
+      prove(name, problemFile, timeLimit, out, connection);
+      continue;
+    }
+    out << "error unknown command " << cmd << endl;
+  }
+  return true;
+} // ServerMode::serve
+
+/**
+ * Parse @b files and keep them as the library @b name,
+ * replacing a previous library of the same name.
+ */
+void ServerMode::loadLibrary(const vstring& name, const Stack<vstring>& files, ostream& out)
+{
+  CALL("ServerMode::loadLibrary");
+  TIME_TRACE(TimeTrace::PARSING);
+
+  UnitList* units = 0;
+  try {
+    Stack<vstring>::BottomFirstIterator fit(files);
+    while (fit.hasNext()) {
+      vstring fname = env.options->includeFileName(fit.next());
+
+      ifstream inp(fname.c_str());
+      if (inp.fail()) {
+        USER_ERROR("Cannot open library file: "+fname);
+      }
+      Parse::TPTP parser(inp);
+      parser.parse();
+      if (parser.containsConjecture()) {
+        USER_ERROR("Library file " + fname + " contains a conjecture.");
+      }
+      UnitList* funits = parser.units();
+      UnitList::Iterator fuit(funits);
+      while (fuit.hasNext()) {
+        fuit.next()->inference().markIncluded();
+      }
+      units = UnitList::concat(units, funits);
+    }
+  }
+  catch (Exception& exception) {
+    out << "error ";
+    exception.cry(out);
+    out << endl;
+    return;
+  }
+
+  Library* lib;
+  if (!_libraries.find(name, lib)) {
+    lib = new Library();
+    lib->sine = 0;
+    _libraries.insert(name, lib);
+  }
+  else {
+    delete lib->problem;
+    delete lib->sine;
+  }
+  lib->problem = new Problem(units);
+  lib->files = files;
+  // scan the library for its property here, so that queries only need to add their own units
+  lib->problem->getProperty();
+  if (env.options->sineSelection() != Options::SineSelection::OFF) {
+    lib->sine = new SineTheorySelector(*env.options);
+    lib->sine->initSelectionStructure(units);
+  }
+  env.statistics->phase=Statistics::UNKNOWN_PHASE;
+
+  out << "ok " << UnitList::length(units) << endl;
+} // ServerMode::loadLibrary
+
+/**
+ * Run a query in a child process whose output goes to @b connection.
+ */
+void ServerMode::prove(const vstring& name, const vstring& problemFile, int timeLimit, ostream& out, int connection)
+{
+  CALL("ServerMode::prove");
+
+  Library* lib;
+  if (!_libraries.find(name, lib)) {
+    out << "error unknown library " << name << endl;
+    return;
+  }
+
+  out << flush;
+  cout << flush;
+  pid_t child = Multiprocessing::instance()->fork();
+  if (!child) {
+    TIME_TRACE_NEW_ROOT("query process")
+    close(_listenSocket);
+    dup2(connection, STDOUT_FILENO);
+    try {
+      runQuery(lib, problemFile, timeLimit);
+    } catch (Exception& exc) {
+      cout << "% Exception at query level" << endl;
+      exc.cry(cout);
+      cout << flush;
+      System::terminateImmediately(1);
+    }
+  }
+
+  int resValue;
+  try {
+    ALWAYS(Multiprocessing::instance()->waitForChildTermination(resValue) == child);
+  }
+  catch (SystemFailException& ex) {
+    cerr << "% SystemFailException at server level" << endl;
+    ex.cry(cerr);
+    resValue = 1;
+  }
+  out << "done " << resValue << endl;
+} // ServerMode::prove
+
+/**
+ * Prove @b problemFile with the axioms of @b lib and terminate,
+ * with status 0 if the problem was solved.
+ */
+void ServerMode::runQuery(Library* lib, const vstring& problemFile, int timeLimit)
+{
+  CALL("ServerMode::runQuery");
+
+  env.timer->reset();
+  env.timer->start();
+  env.options->setTimeLimitInDeciseconds(timeLimit);
+  env.options->setInputFile(problemFile);
+  env.options->setProblemName(problemFile);
+
+  UnitList* units;
+  {
+    TIME_TRACE(TimeTrace::PARSING);
+    env.statistics->phase=Statistics::PARSING;
+
+    ifstream inp(problemFile.c_str());
+    if (inp.fail()) {
+      USER_ERROR("Cannot open problem file: " + problemFile);
+    }
+    Parse::TPTP parser(inp);
+    Stack<vstring>::BottomFirstIterator fit(lib->files);
+    while (fit.hasNext()) {
+      parser.addForbiddenInclude(fit.next());
+    }
+    parser.parse();
+    UIHelper::setConjecturePresence(parser.containsConjecture());
+    units = parser.units();
+  }
+  env.statistics->phase=Statistics::UNKNOWN_PHASE;
+
+  Problem* prb;
+  if (lib->sine && env.options->sineSelection() != Options::SineSelection::OFF) {
+    // select from the library index, so that only the selected axioms are preprocessed
+    lib->sine->perform(units);
+    prb = new Problem(units);
+    prb->reportIncompleteTransformation();
+    env.options->setSineSelection(Options::SineSelection::OFF);
+  }
+  else {
+    prb = lib->problem->copy();
+    prb->addUnits(units);
+  }
+
+  ProvingHelper::runVampire(*prb, *env.options);
+
+  System::ignoreSIGHUP(); // don't interrupt now, we need to finish printing the proof !
+
+  env.beginOutput();
+  UIHelper::outputResult(env.out());
+  env.endOutput();
+  cout << flush;
+
+  bool solved = env.statistics->terminationReason == Statistics::REFUTATION ||
+                env.statistics->terminationReason == Statistics::SATISFIABLE;
+  System::terminateImmediately(solved ? 0 : 1);
+} // ServerMode::runQuery
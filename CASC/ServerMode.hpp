@@ -0,0 +1,86 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ServerMode.hpp
+ * Defines class ServerMode.
+ */
+
+#ifndef __ServerMode__
+#define __ServerMode__
+
+#include <iosfwd>
+
+#include "Forwards.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
+#include "Lib/VString.hpp"
+
+#include "Shell/SineUtils.hpp"
+
+namespace CASC {
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * A long-running prover which keeps axiom libraries loaded between queries.
+ *
+ * The server listens on the Unix socket given by the server_socket option
+ * and reads line-based commands from each connection:
+ *
+ *   library <name> <file>...     parse the files and keep them as library @b name
+ *   prove <name> <file> [limit]  prove the problem in @b file using library @b name,
+ *                                optionally with a time limit in deciseconds
+ *   quit                         stop the server
+ *
+ * A library is parsed (and its property computed) once, in the server process.
+ * If SInE selection is on, its D-relation is also built once and each query
+ * only selects from it.
+ * Every query then runs in a forked child, which shares the library with the
+ * server copy-on-write, and writes its usual output into the connection,
+ * followed by a "done <exit status>" line from the server.
+ *
+ * Library files are treated as forbidden includes of the queried problems,
+ * so problems may keep including them under the name used in the library command.
+ */
+class ServerMode
+{
+public:
+  static void perform();
+private:
+  struct Library
+  {
+    CLASS_NAME(ServerMode::Library);
+    USE_ALLOCATOR(Library);
+
+    Problem* problem;
+    /** index for selecting from the library, 0 if SInE selection is off */
+    Shell::SineTheorySelector* sine;
+    Stack<vstring> files;
+  };
+
+  ServerMode() : _queryTimeLimit(0) {}
+
+  bool serve(istream& in, ostream& out, int connection);
+  void loadLibrary(const vstring& name, const Stack<vstring>& files, ostream& out);
+  void prove(const vstring& name, const vstring& problemFile, int timeLimit, ostream& out, int connection);
+  [[noreturn]] void runQuery(Library* lib, const vstring& problemFile, int timeLimit);
+
+  /** the default time limit of a query (in deciseconds), 0 means no limit */
+  int _queryTimeLimit;
+  int _listenSocket;
+  DHMap<vstring,Library*> _libraries;
+};
+
+}
+
+#endif // __ServerMode__
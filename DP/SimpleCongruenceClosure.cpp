@@ -87,36 +87,7 @@ void SimpleCongruenceClosure::ConstInfo::init() {
   predecessorPremise = CEq(0,0);
   classList.reset();
   useList.reset();
-}
-
-void SimpleCongruenceClosure::ConstInfo::resetEquivalences(SimpleCongruenceClosure& parent, unsigned selfIndex) {
-  CALL("SimpleCongruenceClosure::ConstInfo::resetEquivalences");
-
-  reprConst = 0;
-  proofPredecessor = 0;
-  predecessorPremise = CEq(0,0);
-  classList.reset();
-
-  static ArraySet seen;
-  seen.ensure(parent.getMaxConst()+1);
-  seen.reset();
-
-  Stack<unsigned>::DelIterator ulit(useList);
-  // Martin: keep only those namedPairs in useList for which selfIndex
-  // is one of the arguments, and keep each such exactly once
-  while(ulit.hasNext()) {
-    unsigned p = ulit.next();
-    ConstInfo& pInfo = parent._cInfos[p];
-    if(pInfo.namedPair.first!=selfIndex && pInfo.namedPair.second!=selfIndex) {
-      ulit.del();
-      continue;
-    }
-    if(seen.find(p)) {
-      ulit.del();
-      continue;
-    }
-    seen.insert(p);
-  }
+  registered = false;
 }
 
 #if VDEBUG
@@ -152,30 +123,15 @@ SimpleCongruenceClosure::SimpleCongruenceClosure(Ordering* ord) :
   _posLitConst = getFreshConst();
   _negLitConst = getFreshConst();
   _negEqualities.push(CEq(_posLitConst, _negLitConst, 0));
-
-  _hadPropagated = false;
 }
 
 void SimpleCongruenceClosure::reset()
 {
   CALL("SimpleCongruenceClosure::reset");
 
-  //do reset that keeps the data for converting terms to constants
-  unsigned maxConst = getMaxConst();
-  for(unsigned i=1; i<=maxConst; i++) {
-    _cInfos[i].resetEquivalences(*this, i);
-  }
-
-  PairMap::DelIterator pmit(_pairNames);
-  while(pmit.hasNext()) {
-    CPair namePair;
-    unsigned nameConst;
-    pmit.next(namePair, nameConst);
-
-    if(_cInfos[nameConst].namedPair!=namePair) {
-      pmit.del();
-    }
-  }
+  //undo all the changes, this keeps the data for converting terms to constants
+  undoTrail(0);
+  _levels.reset();
 
   //this leaves us just with the true!=false non-equality
   _negEqualities.truncate(1);
@@ -188,8 +144,80 @@ void SimpleCongruenceClosure::reset()
   _pendingEqualities.reset();
   _distinctConstraints.reset();
   _negDistinctConstraints.reset();
+}
+
+void SimpleCongruenceClosure::push()
+{
+  CALL("SimpleCongruenceClosure::push");
+
+  propagate();
+
+  Level lev;
+  lev.trail = _trail.size();
+  lev.negEqualities = _negEqualities.size();
+  lev.distincts = _distinctConstraints.size();
+  lev.negDistincts = _negDistinctConstraints.size();
+  _levels.push(lev);
+}
+
+void SimpleCongruenceClosure::pop()
+{
+  CALL("SimpleCongruenceClosure::pop");
+
+  Level lev = _levels.pop();
+  undoTrail(lev.trail);
+  _negEqualities.truncate(lev.negEqualities);
+  _distinctConstraints.truncate(lev.distincts);
+  _negDistinctConstraints.truncate(lev.negDistincts);
+
+  //everything pending was added after the push, which propagated the rest
+  _pendingEqualities.reset();
+  _unsatEqs.reset();
+}
 
-  _hadPropagated = false;
+/**
+ * Undo the changes recorded on the trail until it has @c size entries
+ */
+void SimpleCongruenceClosure::undoTrail(unsigned size)
+{
+  CALL("SimpleCongruenceClosure::undoTrail");
+
+  while(_trail.size()>size) {
+    TrailEntry e = _trail.pop();
+    switch(e.kind) {
+    case TrailEntry::SIG_TABLE:
+      ALWAYS(_sigTable.remove(e.pair));
+      break;
+    case TrailEntry::REGISTER:
+      _cInfos[e.pair.second].useList.truncate(e.size2);
+      _cInfos[e.pair.first].useList.truncate(e.size1);
+      _cInfos[e.c].registered = false;
+      break;
+    case TrailEntry::MERGE:
+    {
+      ConstInfo& aInfo = _cInfos[e.c];
+      ConstInfo& bInfo = _cInfos[e.d];
+      bInfo.useList.truncate(e.size2);
+      bInfo.classList.truncate(e.size1);
+      aInfo.reprConst = 0;
+      Stack<unsigned>::Iterator aChildIt(aInfo.classList);
+      while(aChildIt.hasNext()) {
+        _cInfos[aChildIt.next()].reprConst = e.c;
+      }
+
+      //later merges may have reversed the proof edge, but not removed it
+      unsigned p1 = e.pair.first;
+      unsigned p2 = e.pair.second;
+      if(_cInfos[p1].proofPredecessor!=p2) {
+        swap(p1,p2);
+      }
+      ASS_EQ(_cInfos[p1].proofPredecessor,p2);
+      _cInfos[p1].proofPredecessor = 0;
+      _cInfos[p1].predecessorPremise = CEq(0,0);
+      break;
+    }
+    }
+  }
 }
 
 /** Introduce fresh congruence closure constant */
@@ -232,24 +260,59 @@ unsigned SimpleCongruenceClosure::getPairName(CPair p)
   _cInfos[res].namedPair = p;
   *pRes = res;
 
-  _cInfos[p.first].useList.push(res);
-  if(_cInfos[p.first].reprConst!=0) {
-    // Martin: if we are here, the above insertion was not needed now,
-    // but will become necessary after reset(); see resetEquivalences
-    unsigned fRepr = _cInfos[p.first].reprConst;
-    _cInfos[fRepr].useList.push(res);
-  }
-  _cInfos[p.second].useList.push(res);
-  if(_cInfos[p.second].reprConst!=0) {
-    // Martin: if we are here, the above insertion was not needed now,
-    // but will become necessary after reset(); see resetEquivalences
-    unsigned sRepr = _cInfos[p.second].reprConst;
-    _cInfos[sRepr].useList.push(res);
-  }
-
   return res;
 }
 
+/**
+ * Make the closure aware of the pair named by @c c and of the pairs in its
+ * arguments, so that they take part in the congruence
+ */
+void SimpleCongruenceClosure::registerConst(unsigned c)
+{
+  CALL("SimpleCongruenceClosure::registerConst");
+
+  static Stack<unsigned> toDo;
+  ASS(toDo.isEmpty());
+  toDo.push(c);
+
+  while(toDo.isNonEmpty()) {
+    unsigned d = toDo.top();
+    CPair p = _cInfos[d].namedPair;
+    if(_cInfos[d].registered || p==CPair(0,0)) {
+      toDo.pop();
+      continue;
+    }
+    //the arguments go first
+    if(!_cInfos[p.first].registered && _cInfos[p.first].namedPair!=CPair(0,0)) {
+      toDo.push(p.first);
+      continue;
+    }
+    if(!_cInfos[p.second].registered && _cInfos[p.second].namedPair!=CPair(0,0)) {
+      toDo.push(p.second);
+      continue;
+    }
+    toDo.pop();
+
+    CPair derefPair = deref(p);
+    TrailEntry reg(TrailEntry::REGISTER, d, 0, derefPair);
+    reg.size1 = _cInfos[derefPair.first].useList.size();
+    _cInfos[derefPair.first].useList.push(d);
+    reg.size2 = _cInfos[derefPair.second].useList.size();
+    _cInfos[derefPair.second].useList.push(d);
+    _trail.push(reg);
+    _cInfos[d].registered = true;
+
+    unsigned* pDerefPairName;
+    if(!_sigTable.getValuePtr(derefPair, pDerefPairName)) {
+      addPendingEquality(CEq(*pDerefPairName, d));
+    }
+    else {
+      *pDerefPairName = d;
+      _trail.push(TrailEntry(TrailEntry::SIG_TABLE, 0, 0, derefPair));
+    }
+  }
+}
+
 struct SimpleCongruenceClosure::FOConversionWorker
 {
   FOConversionWorker(SimpleCongruenceClosure& parent)
@@ -383,6 +446,7 @@ void SimpleCongruenceClosure::readDistinct(Literal* lit)
   while(ait.hasNext()) {
     TermList arg = ait.next();
     unsigned cNum = convertFO(arg);
+    registerConst(cNum);
     tgtStack.push(cNum);
   }
 }
@@ -421,7 +485,6 @@ SimpleCongruenceClosure::CEq SimpleCongruenceClosure::convertFOEquality(Literal*
 void SimpleCongruenceClosure::addLiterals(LiteralIterator lits, bool onlyEqualites)
 {
   CALL("SimpleCongruenceClosure::addLiterals");
-  ASS(!_hadPropagated);
 
   while(lits.hasNext()) {
     Literal* l = lits.next();
@@ -443,6 +506,8 @@ void SimpleCongruenceClosure::addLiteral(Literal* lit)
 
   if (lit->isEquality()) {
     CEq eq = convertFOEquality(lit);
+    registerConst(eq.c1);
+    registerConst(eq.c2);
 
     if (lit->isPositive()) {
       addPendingEquality(eq);
@@ -453,6 +518,7 @@ void SimpleCongruenceClosure::addLiteral(Literal* lit)
     readDistinct(lit);
   } else {
     unsigned predConst = convertFONonEquality(lit);
+    registerConst(predConst);
     CEq eq;
     if(lit->isPositive()) {
       eq = CEq(predConst, _posLitConst, lit);
@@ -509,8 +575,6 @@ void SimpleCongruenceClosure::propagate()
 {
   CALL("SimpleCongruenceClosure::propagate");
 
-  _hadPropagated = true;
-
   while(_pendingEqualities.isNonEmpty()) {
     CEq curr0 = _pendingEqualities.pop_back();
     CPair curr = deref(curr0);
@@ -540,6 +604,11 @@ void SimpleCongruenceClosure::propagate()
 
     ConstInfo& aInfo = _cInfos[aRep];
     ConstInfo& bInfo = _cInfos[bRep];
+
+    TrailEntry merge(TrailEntry::MERGE, aRep, bRep, CPair(curr0.c1, curr0.c2));
+    merge.size1 = bInfo.classList.size();
+    merge.size2 = bInfo.useList.size();
+    _trail.push(merge);
     ASS_EQ(aInfo.reprConst,0); // ensure that they are their own representatives
     ASS_EQ(bInfo.reprConst,0);
 
@@ -568,12 +637,13 @@ void SimpleCongruenceClosure::propagate()
       ASS(usedPair!=derefPair); // Martin: (at least) one of the arguments was aRep, now is bRep
 
       unsigned* pDerefPairName;
-      if(!_pairNames.getValuePtr(derefPair, pDerefPairName)) {
+      if(!_sigTable.getValuePtr(derefPair, pDerefPairName)) {
 	addPendingEquality(CEq(*pDerefPairName, usePairConst));
       }
       else {
 	*pDerefPairName = usePairConst;
 	bInfo.useList.push(usePairConst);
+	_trail.push(TrailEntry(TrailEntry::SIG_TABLE, 0, 0, derefPair));
       }
     }
   }
@@ -657,6 +727,9 @@ DecisionProcedure::Status SimpleCongruenceClosure::getStatus(bool retrieveMultip
 {
   CALL("SimpleCongruenceClosure::getStatus");
 
+  // cores of an earlier call are no longer valid
+  _unsatEqs.reset();
+
   // Propagate any pending equalities
   propagate();
 
@@ -44,6 +44,12 @@ using namespace Kernel;
  * 
  * However, classList of a representative 
  * does not (physically) contain that representative (only logically)
+ *
+ * The closure is backtrackable: all changes to the equivalence classes,
+ * use lists, the signature table and the proof forest are recorded on a trail,
+ * so that push() and pop() can follow the AVATAR model without
+ * rebuilding the closure from scratch. The translation of terms
+ * to constants is kept across pop() and reset().
  */
 class SimpleCongruenceClosure : public DecisionProcedure
 {
@@ -63,6 +69,16 @@ public:
   
   virtual void reset() override;
 
+  /**
+   * Start a new backtracking level. Pending equalities are propagated,
+   * literals added after this call are retracted by the matching pop().
+   */
+  void push();
+  /** Retract all literals added since the last call to push() */
+  void pop();
+  /** Number of backtracking levels, i.e. of push() calls not matched by a pop() */
+  unsigned level() const { return _levels.size(); }
+
   /**
    * New, more fine-grained way of insertion. The terms may contain variables which are treated as constants.
    */
@@ -125,6 +141,7 @@ private:
   unsigned getFreshConst();
   unsigned getSignatureConst(unsigned symbol, SignatureKind kind);
   unsigned getPairName(CPair p);
+  void registerConst(unsigned c);
 
 
   struct FOConversionWorker;
@@ -173,7 +190,6 @@ private:
   struct ConstInfo
   {
     void init();
-    void resetEquivalences(SimpleCongruenceClosure& parent, unsigned selfIndex);
 
 #if VDEBUG
     void assertValid(SimpleCongruenceClosure& parent, unsigned selfIndex) const;
@@ -208,12 +224,16 @@ private:
      * this constant is */
     Stack<unsigned> classList;
     /**
-     * If reprConst==0, contains list of pair names in whose pairs this
-     * constant appears as a representative of one of the arguments.
-     * Irregardless of the value of reprConst, also contains representatives
-     * of all pairs that have this very constant as one of arguments.
+     * If reprConst==0, contains list of registered pair names in whose pairs
+     * this constant appears as a representative of one of the arguments.
      */
     Stack<unsigned> useList;
+    /**
+     * Meaningful for namedPairs. The pair occurs in a literal added since
+     * the last reset, so it is in the use lists of the representatives
+     * of its arguments and in the signature table.
+     */
+    bool registered;
         
     // needed for getModel:    
     /**
@@ -270,8 +290,10 @@ private:
   DHMap<pair<unsigned,SignatureKind>,unsigned> _sigConsts;
 
   typedef DHMap<CPair,unsigned> PairMap;
-  /** Names of constant pairs (modulo the congruence!)*/
+  /** Names of constant pairs (as they were created, not modulo the congruence) */
   PairMap _pairNames;
+  /** Names of registered constant pairs modulo the congruence */
+  PairMap _sigTable;
 
   /** Constants corresponding to terms */
   DHMap<TermList,unsigned> _termNames;
@@ -300,11 +322,43 @@ private:
    * "It can be used only as a fact, not under any connective." */  
   DistinctStack _negDistinctConstraints;
 
-  /**
-   * used to assert we don't add literals after propagation.
-   * this would cause problems with term caches upon reset.
-   */
-  bool _hadPropagated;
+  /** A change of the congruence closure state which pop() can undo */
+  struct TrailEntry
+  {
+    enum Kind {
+      /** class of @c c was merged into the class of @c d,
+       * @c pair is the proof forest edge added by the merge */
+      MERGE,
+      /** pair @c c was registered, @c pair are the representatives of its arguments */
+      REGISTER,
+      /** key @c pair was inserted into the signature table */
+      SIG_TABLE
+    };
+
+    TrailEntry(Kind kind, unsigned c, unsigned d, CPair pair)
+     : kind(kind), c(c), d(d), pair(pair), size1(0), size2(0) {}
+
+    Kind kind;
+    unsigned c;
+    unsigned d;
+    CPair pair;
+    /** sizes of the modified lists before the change */
+    unsigned size1;
+    unsigned size2;
+  };
+  void undoTrail(unsigned size);
+
+  Stack<TrailEntry> _trail;
+
+  /** Sizes of the trail and of the literal stacks at a call to push() */
+  struct Level
+  {
+    unsigned trail;
+    unsigned negEqualities;
+    unsigned distincts;
+    unsigned negDistincts;
+  };
+  Stack<Level> _levels;
 }; // class SimpleCongruenceClosure
 
 }
@@ -0,0 +1,516 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file Simplex.cpp
+ * Implements class Simplex.
+ */
+
+#include <algorithm>
+
+#include "Lib/Environment.hpp"
+
+#include "Kernel/Signature.hpp"
+#include "Kernel/SortHelper.hpp"
+
+#include "Simplex.hpp"
+
+namespace DP
+{
+
+void Simplex::reset()
+{
+  CALL("Simplex::reset");
+
+  _status = UNKNOWN;
+  _incomplete = false;
+  _atoms.reset();
+  _lower.reset();
+  _upper.reset();
+  _values.reset();
+  _slacks.reset();
+  _slackSums.reset();
+  _rows.reset();
+  _basic.reset();
+  _unsatCore.reset();
+}
+
+void Simplex::addLiterals(LiteralIterator lits, bool onlyEqualities)
+{
+  CALL("Simplex::addLiterals");
+
+  while (lits.hasNext()) {
+    Literal* lit = lits.next();
+    if (onlyEqualities && !lit->isEquality()) {
+      continue;
+    }
+    addLiteral(lit);
+  }
+}
+
+unsigned Simplex::newVar()
+{
+  unsigned var = _values.size();
+  _lower.push(Bound());
+  _upper.push(Bound());
+  _values.push(DeltaRat());
+  return var;
+}
+
+static bool tryNumeral(Term* t, RationalConstantType& res)
+{
+  IntegerConstantType intVal;
+  RealConstantType realVal;
+  if (theory->tryInterpretConstant(t, intVal)) {
+    res = RationalConstantType(intVal);
+    return true;
+  }
+  if (theory->tryInterpretConstant(t, realVal)) {
+    res = realVal.representation();
+    return true;
+  }
+  return theory->tryInterpretConstant(t, res);
+}
+
+/**
+ * Add @b coef * @b t to the linear combination @b sum + @b constant
+ * (@b sum is not kept sorted here)
+ */
+void Simplex::linearize(TermList t, const Rat& coef, LinearSum& sum, Rat& constant)
+{
+  CALL("Simplex::linearize");
+  ASS(t.isTerm());
+
+  Term* trm = t.term();
+  Rat num;
+  if (tryNumeral(trm, num)) {
+    constant = constant + coef*num;
+    return;
+  }
+  if (theory->isInterpretedFunction(trm)) {
+    switch (theory->interpretFunction(trm)) {
+    case Theory::INT_PLUS:
+    case Theory::RAT_PLUS:
+    case Theory::REAL_PLUS:
+      linearize(*trm->nthArgument(0), coef, sum, constant);
+      linearize(*trm->nthArgument(1), coef, sum, constant);
+      return;
+    case Theory::INT_MINUS:
+    case Theory::RAT_MINUS:
+    case Theory::REAL_MINUS:
+      linearize(*trm->nthArgument(0), coef, sum, constant);
+      linearize(*trm->nthArgument(1), -coef, sum, constant);
+      return;
+    case Theory::INT_UNARY_MINUS:
+    case Theory::RAT_UNARY_MINUS:
+    case Theory::REAL_UNARY_MINUS:
+      linearize(*trm->nthArgument(0), -coef, sum, constant);
+      return;
+    case Theory::INT_MULTIPLY:
+    case Theory::RAT_MULTIPLY:
+    case Theory::REAL_MULTIPLY:
+      if (trm->nthArgument(0)->isTerm() && tryNumeral(trm->nthArgument(0)->term(), num)) {
+        linearize(*trm->nthArgument(1), coef*num, sum, constant);
+        return;
+      }
+      if (trm->nthArgument(1)->isTerm() && tryNumeral(trm->nthArgument(1)->term(), num)) {
+        linearize(*trm->nthArgument(0), coef*num, sum, constant);
+        return;
+      }
+      // a non-linear product, which we can only treat as an atom
+      _incomplete = true;
+      break;
+    default:
+      // other functions relate their value to the arguments
+      _incomplete = true;
+      break;
+    }
+  }
+
+  unsigned* var;
+  if (_atoms.getValuePtr(trm, var)) {
+    *var = newVar();
+  }
+  sum.push(make_pair(*var, coef));
+}
+
+/**
+ * Record the literal as a bound of an atom or of a new slack variable
+ */
+void Simplex::addLiteral(Literal* lit)
+{
+  CALL("Simplex::addLiteral");
+
+  if (_status==UNSATISFIABLE || !lit->ground()) {
+    return;
+  }
+
+  // the literal is normalised to lhs - rhs < 0, lhs - rhs <= 0 or lhs - rhs = 0
+  TermList lhs, rhs;
+  bool strict = false;
+  bool equality = false;
+  TermList sort;
+  if (lit->isEquality()) {
+    sort = SortHelper::getEqualityArgumentSort(lit);
+    if (sort!=AtomicSort::intSort() && sort!=AtomicSort::rationalSort() && sort!=AtomicSort::realSort()) {
+      return;
+    }
+    if (lit->isNegative()) {
+      // disequalities would require case splitting
+      _incomplete = true;
+      return;
+    }
+    lhs = *lit->nthArgument(0);
+    rhs = *lit->nthArgument(1);
+    equality = true;
+  }
+  else {
+    if (!theory->isInterpretedPredicate(lit->functor()) || lit->arity()!=2) {
+      return;
+    }
+    TermList s = *lit->nthArgument(0);
+    TermList t = *lit->nthArgument(1);
+    switch (theory->interpretPredicate(lit)) {
+    case Theory::INT_LESS:
+    case Theory::RAT_LESS:
+    case Theory::REAL_LESS:
+      // s < t, or t <= s if negated
+      lhs = lit->isPositive() ? s : t;
+      rhs = lit->isPositive() ? t : s;
+      strict = lit->isPositive();
+      break;
+    case Theory::INT_LESS_EQUAL:
+    case Theory::RAT_LESS_EQUAL:
+    case Theory::REAL_LESS_EQUAL:
+      // s <= t, or t < s if negated
+      lhs = lit->isPositive() ? s : t;
+      rhs = lit->isPositive() ? t : s;
+      strict = lit->isNegative();
+      break;
+    case Theory::INT_GREATER:
+    case Theory::RAT_GREATER:
+    case Theory::REAL_GREATER:
+      // t < s, or s <= t if negated
+      lhs = lit->isPositive() ? t : s;
+      rhs = lit->isPositive() ? s : t;
+      strict = lit->isPositive();
+      break;
+    case Theory::INT_GREATER_EQUAL:
+    case Theory::RAT_GREATER_EQUAL:
+    case Theory::REAL_GREATER_EQUAL:
+      // t <= s, or s < t if negated
+      lhs = lit->isPositive() ? t : s;
+      rhs = lit->isPositive() ? s : t;
+      strict = lit->isNegative();
+      break;
+    default:
+      return;
+    }
+    sort = SortHelper::getArgSort(lit, 0);
+  }
+  bool integral = sort==AtomicSort::intSort();
+  if (integral) {
+    _incomplete = true;
+  }
+
+  LinearSum sum;
+  Rat constant(0);
+  linearize(lhs, Rat(1), sum, constant);
+  linearize(rhs, Rat(-1), sum, constant);
+
+  // merge the coefficients of each variable
+  std::sort(sum.begin(), sum.end(), [](const pair<unsigned,Rat>& a, const pair<unsigned,Rat>& b) { return a.first<b.first; });
+  unsigned len = 0;
+  for (unsigned i = 0; i < sum.size(); i++) {
+    if (len && sum[len-1].first==sum[i].first) {
+      sum[len-1].second = sum[len-1].second + sum[i].second;
+    }
+    else {
+      sum[len++] = sum[i];
+    }
+    if (sum[len-1].second.isZero()) {
+      len--;
+    }
+  }
+  sum.truncate(len);
+
+  // the constraint is now sum < -constant, sum <= -constant or sum = -constant
+  DeltaRat bound(-constant, strict ? Rat(-1) : Rat(0));
+
+  if (sum.isEmpty()) {
+    bool holds = equality ? bound.val.isZero() : (strict ? bound.val.isPositive() : !bound.val.isNegative());
+    if (!holds) {
+      setConflict(lit, 0);
+    }
+    return;
+  }
+
+  unsigned var;
+  bool upper = true;
+  if (sum.size()==1) {
+    // a bound of the atom itself
+    var = sum[0].first;
+    Rat coef = sum[0].second;
+    bound = bound * (Rat(1) / coef);
+    if (coef.isNegative()) {
+      upper = false;
+    }
+  }
+  else {
+    var = newVar();
+    _slacks.push(var);
+    _slackSums.push(sum);
+  }
+
+  addBound(var, upper, bound, integral, lit);
+  if (equality) {
+    addBound(var, !upper, bound, integral, lit);
+  }
+}
+
+/**
+ * Add a bound of the variable @b var. If @b integral, the variable
+ * has integer values and the bound is rounded.
+ */
+void Simplex::addBound(unsigned var, bool upper, DeltaRat value, bool integral, Literal* reason)
+{
+  CALL("Simplex::addBound");
+
+  if (_status==UNSATISFIABLE) {
+    return;
+  }
+  if (integral) {
+    if (upper) {
+      value = DeltaRat(value.delta.isNegative() && value.val.isInt() ? value.val - Rat(1) : value.val.floor(), Rat(0));
+    }
+    else {
+      value = DeltaRat(value.delta.isPositive() && value.val.isInt() ? value.val + Rat(1) : value.val.ceiling(), Rat(0));
+    }
+  }
+
+  if (upper) {
+    if (_upper[var].isSet() && !(value < _upper[var].value)) {
+      return;
+    }
+    _upper[var] = Bound(value, reason);
+    if (_lower[var].isSet() && value < _lower[var].value) {
+      setConflict(reason, _lower[var].reason);
+    }
+  }
+  else {
+    if (_lower[var].isSet() && !(_lower[var].value < value)) {
+      return;
+    }
+    _lower[var] = Bound(value, reason);
+    if (_upper[var].isSet() && _upper[var].value < value) {
+      setConflict(reason, _upper[var].reason);
+    }
+  }
+}
+
+void Simplex::setConflict(Literal* l1, Literal* l2)
+{
+  _status = UNSATISFIABLE;
+  _unsatCore.reset();
+  _unsatCore.push(l1);
+  if (l2 && l2!=l1) {
+    _unsatCore.push(l2);
+  }
+}
+
+void Simplex::buildTableau()
+{
+  CALL("Simplex::buildTableau");
+
+  unsigned varCnt = _values.size();
+  // non-basic variables have to satisfy their bounds
+  for (unsigned v = 0; v < varCnt; v++) {
+    if (_lower[v].isSet()) {
+      _values[v] = _lower[v].value;
+    }
+    else if (_upper[v].isSet()) {
+      _values[v] = _upper[v].value;
+    }
+  }
+  for (unsigned i = 0; i < _slacks.size(); i++) {
+    _rows.push(Stack<Rat>(varCnt));
+    Stack<Rat>& row = _rows.top();
+    for (unsigned v = 0; v < varCnt; v++) {
+      row.push(Rat(0));
+    }
+    DeltaRat value;
+    for (auto& summand : _slackSums[i]) {
+      row[summand.first] = summand.second;
+      value = value + _values[summand.first] * summand.second;
+    }
+    _values[_slacks[i]] = value;
+    _basic.push(_slacks[i]);
+  }
+}
+
+/**
+ * Look for values satisfying all the bounds. Return false
+ * and set the unsat core if there are none.
+ */
+bool Simplex::check()
+{
+  CALL("Simplex::check");
+
+  for (;;) {
+    // by Bland's rule, take the violated basic variable with the smallest index,
+    // and the smallest non-basic variable to fix it, which ensures termination
+    unsigned row = _rows.size();
+    bool belowLower = false;
+    for (unsigned i = 0; i < _rows.size(); i++) {
+      unsigned b = _basic[i];
+      if (row<_rows.size() && _basic[row]<b) {
+        continue;
+      }
+      if (_lower[b].isSet() && _values[b] < _lower[b].value) {
+        row = i;
+        belowLower = true;
+      }
+      else if (_upper[b].isSet() && _upper[b].value < _values[b]) {
+        row = i;
+        belowLower = false;
+      }
+    }
+    if (row==_rows.size()) {
+      return true;
+    }
+
+    Stack<Rat>& coefs = _rows[row];
+    unsigned entering = _values.size();
+    for (unsigned v = 0; v < _values.size(); v++) {
+      if (coefs[v].isZero()) {
+        continue;
+      }
+      bool increase = belowLower==coefs[v].isPositive();
+      if (increase ? canIncrease(v) : canDecrease(v)) {
+        entering = v;
+        break;
+      }
+    }
+    if (entering==_values.size()) {
+      rowConflict(row, belowLower);
+      return false;
+    }
+    unsigned b = _basic[row];
+    pivotAndUpdate(row, entering, belowLower ? _lower[b].value : _upper[b].value);
+  }
+}
+
+/**
+ * The basic variable of @b row violates its bound and none of the
+ * variables it depends on can be changed to fix it. The bounds
+ * of these variables are the conflict.
+ */
+void Simplex::rowConflict(unsigned row, bool belowLower)
+{
+  CALL("Simplex::rowConflict");
+
+  _status = UNSATISFIABLE;
+  _unsatCore.reset();
+  unsigned b = _basic[row];
+  _unsatCore.push(belowLower ? _lower[b].reason : _upper[b].reason);
+
+  Stack<Rat>& coefs = _rows[row];
+  for (unsigned v = 0; v < _values.size(); v++) {
+    if (coefs[v].isZero()) {
+      continue;
+    }
+    // the variable is stuck at the bound preventing the change
+    Literal* reason = belowLower==coefs[v].isPositive() ? _upper[v].reason : _lower[v].reason;
+    ASS(reason);
+    if (!_unsatCore.find(reason)) {
+      _unsatCore.push(reason);
+    }
+  }
+}
+
+/**
+ * Set the basic variable of @b row to @b value by changing the non-basic
+ * variable @b entering, and swap their roles.
+ */
+void Simplex::pivotAndUpdate(unsigned row, unsigned entering, DeltaRat value)
+{
+  CALL("Simplex::pivotAndUpdate");
+
+  unsigned leaving = _basic[row];
+  Stack<Rat>& pivotRow = _rows[row];
+  Rat inv = Rat(1) / pivotRow[entering];
+
+  // update the values
+  DeltaRat theta = (value - _values[leaving]) * inv;
+  _values[leaving] = value;
+  _values[entering] = _values[entering] + theta;
+  for (unsigned i = 0; i < _rows.size(); i++) {
+    if (i!=row && !_rows[i][entering].isZero()) {
+      _values[_basic[i]] = _values[_basic[i]] + theta * _rows[i][entering];
+    }
+  }
+
+  // leaving = a*entering + rest becomes entering = (1/a)*leaving - (1/a)*rest
+  for (unsigned v = 0; v < _values.size(); v++) {
+    if (!pivotRow[v].isZero()) {
+      pivotRow[v] = -(pivotRow[v] * inv);
+    }
+  }
+  pivotRow[entering] = Rat(0);
+  pivotRow[leaving] = inv;
+  _basic[row] = entering;
+
+  // substitute for entering in the other rows
+  for (unsigned i = 0; i < _rows.size(); i++) {
+    Stack<Rat>& coefs = _rows[i];
+    if (i==row || coefs[entering].isZero()) {
+      continue;
+    }
+    Rat c = coefs[entering];
+    coefs[entering] = Rat(0);
+    for (unsigned v = 0; v < _values.size(); v++) {
+      if (!pivotRow[v].isZero()) {
+        coefs[v] = coefs[v] + c * pivotRow[v];
+      }
+    }
+  }
+}
+
+DecisionProcedure::Status Simplex::getStatus(bool retrieveMultipleCores)
+{
+  CALL("Simplex::getStatus");
+
+  if (_status==UNSATISFIABLE) {
+    return _status;
+  }
+  try {
+    buildTableau();
+    if (!check()) {
+      ASS_EQ(_status, UNSATISFIABLE);
+      return _status;
+    }
+  }
+  catch (ArithmeticException&) {
+    return _status = UNKNOWN;
+  }
+  _status = _incomplete ? UNKNOWN : SATISFIABLE;
+  return _status;
+}
+
+void Simplex::getUnsatCore(LiteralStack& res, unsigned coreIndex)
+{
+  CALL("Simplex::getUnsatCore");
+  ASS_EQ(_status, UNSATISFIABLE);
+  ASS_EQ(coreIndex, 0);
+  ASS(res.isEmpty());
+
+  res = _unsatCore;
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file Simplex.hpp
+ * Defines class Simplex, a decision procedure for ground linear arithmetic.
+ */
+
+#ifndef __Simplex__
+#define __Simplex__
+
+#include "Forwards.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Term.hpp"
+#include "Kernel/Theory.hpp"
+
+#include "DecisionProcedure.hpp"
+
+namespace DP {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Decision procedure for conjunctions of ground linear arithmetic literals,
+ * using the general simplex method of Dutertre and de Moura (2006)
+ * A Fast Linear-Arithmetic Solver for DPLL(T).
+ *
+ * Sums, differences, unary minus and multiplication by numerals are
+ * interpreted, any other term (constants, uninterpreted functions,
+ * non-linear products, ...) is treated as an atom. Each constraint with
+ * more than one atom gets a slack variable whose definition is a row of
+ * the tableau. Strict inequalities are represented by bounds of the form
+ * c +/- delta for an infinitesimal delta.
+ *
+ * Integers are handled by their rational relaxation (with bounds rounded
+ * to integers) and disequalities are ignored, so that only UNSATISFIABLE
+ * answers are exact in these cases, otherwise UNKNOWN is reported.
+ */
+class Simplex : public DecisionProcedure
+{
+public:
+  CLASS_NAME(Simplex);
+  USE_ALLOCATOR(Simplex);
+
+  Simplex() { reset(); }
+
+  virtual void addLiterals(LiteralIterator lits, bool onlyEqualites) override;
+
+  virtual Status getStatus(bool retrieveMultipleCores) override;
+  virtual unsigned getUnsatCoreCount() override { return _status==UNSATISFIABLE ? 1 : 0; }
+  virtual void getUnsatCore(LiteralStack& res, unsigned coreIndex) override;
+
+  /** models are only produced by the congruence closure */
+  void getModel(LiteralStack& model) override {}
+
+  virtual void reset() override;
+
+private:
+  typedef RationalConstantType Rat;
+
+  /** The number val + delta*d for an infinitesimal d */
+  struct DeltaRat
+  {
+    DeltaRat() : val(0), delta(0) {}
+    DeltaRat(Rat val, Rat delta) : val(val), delta(delta) {}
+
+    DeltaRat operator+(const DeltaRat& o) const { return DeltaRat(val+o.val, delta+o.delta); }
+    DeltaRat operator-(const DeltaRat& o) const { return DeltaRat(val-o.val, delta-o.delta); }
+    DeltaRat operator*(const Rat& c) const { return DeltaRat(val*c, delta*c); }
+    bool operator<(const DeltaRat& o) const { return val<o.val || (val==o.val && delta<o.delta); }
+
+    Rat val;
+    Rat delta;
+  };
+
+  /** A bound of a variable, coming from the literal @c reason (0 if there is no bound) */
+  struct Bound
+  {
+    Bound() : reason(0) {}
+    Bound(DeltaRat value, Literal* reason) : value(value), reason(reason) {}
+    bool isSet() const { return reason; }
+
+    DeltaRat value;
+    Literal* reason;
+  };
+
+  /** A linear combination of variables, sorted by the variables */
+  typedef Stack<pair<unsigned,Rat>> LinearSum;
+
+  void addLiteral(Literal* lit);
+  void linearize(TermList t, const Rat& coef, LinearSum& sum, Rat& constant);
+  unsigned newVar();
+  void addBound(unsigned var, bool upper, DeltaRat value, bool integral, Literal* reason);
+  void setConflict(Literal* l1, Literal* l2);
+
+  void buildTableau();
+  bool check();
+  bool canIncrease(unsigned var) const
+  { return !_upper[var].isSet() || _values[var] < _upper[var].value; }
+  bool canDecrease(unsigned var) const
+  { return !_lower[var].isSet() || _lower[var].value < _values[var]; }
+  void pivotAndUpdate(unsigned row, unsigned entering, DeltaRat value);
+  void rowConflict(unsigned row, bool belowLower);
+
+  Status _status;
+  /** true if some literals were relaxed or ignored, so that a solution is not a model */
+  bool _incomplete;
+
+  /** variables for the atoms */
+  DHMap<Term*,unsigned> _atoms;
+  /** bounds and current values of all variables */
+  Stack<Bound> _lower;
+  Stack<Bound> _upper;
+  Stack<DeltaRat> _values;
+
+  /** slack variables and their definitions */
+  Stack<unsigned> _slacks;
+  Stack<LinearSum> _slackSums;
+
+  /**
+   * The tableau: row i expresses the basic variable _basic[i] as a
+   * combination of the non-basic variables (with dense coefficients,
+   * which are zero for the basic variables)
+   */
+  Stack<Stack<Rat>> _rows;
+  Stack<unsigned> _basic;
+
+  LiteralStack _unsatCore;
+};
+
+}
+
+#endif // __Simplex__
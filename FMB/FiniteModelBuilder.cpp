@@ -32,6 +32,7 @@
 
 #include "SAT/MinisatInterfacingNewSimp.hpp"
 #include "SAT/BufferedSolver.hpp"
+#include "SAT/RecordingSolver.hpp"
 
 #include "Lib/Environment.hpp"
 #include "Lib/Timer.hpp"
@@ -59,6 +60,7 @@
 #include "FunctionRelationshipInference.hpp"
 #include "CliqueFinder.hpp"
 #include "Monotonicity.hpp"
+#include "PredicateSymmetry.hpp"
 #include "FiniteModelBuilder.hpp"
 
 #define VTRACE_FMB 0
@@ -116,6 +118,7 @@ FiniteModelBuilder::FiniteModelBuilder(Problem& prb, const Options& opt)
   // Record option values
   _startModelSize = opt.fmbStartSize();
   _symmetryRatio = opt.fmbSymmetryRatio();
+  _predicateSymmetryLength = opt.fmbSymmetryPredicates();
 
   // Load any symbols removed during preprocessing (and their definitions)
   _deletedFunctions.loadFromMap(prb.getEliminatedFunctions());
@@ -230,6 +233,21 @@ bool FiniteModelBuilder::reset(){
     offsets += add; 
   }
 
+  // auxiliary variables of the lex-leader constraints, see addPredicateSymmetryAxioms
+  predicateSymmetry_offset = offsets;
+  for(unsigned o=0;o<_symmetricPredicates.size();o++){
+    const Stack<unsigned>& orbit = _symmetricPredicates[o];
+    for(unsigned i=0;i+1<orbit.size();i++){
+      unsigned add = predicateSymmetryChainLength(orbit[i])-1;
+
+      // Check for overflow
+      if(VAR_MAX - add < offsets){
+        return false;
+      }
+      offsets += add;
+    }
+  }
+
 #if VTRACE_FMB
   cout << "Maximum offset is " << offsets << endl;
 #endif
@@ -277,6 +295,13 @@ bool FiniteModelBuilder::reset(){
     MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
   }
 
+  if(!_opt.recordSatTrace().empty()){
+    // every reset starts a fresh solver, so each one gets its own trace
+    static unsigned solverCnt = 0;
+    _solver = new RecordingSolver(_solver.release(),
+        RecordingSolver::traceFileName(_opt.recordSatTrace(),("fmb"+Int::toString(solverCnt++)).c_str()));
+  }
+
   /*
   if(_opt.satSolver() != Options::SatSolver::MINISAT){
     cout << "Warning: overriding sat solver for FMB, using minisat" << endl;
@@ -953,6 +978,34 @@ void FiniteModelBuilder::init()
       //cout << "done" << endl;
     } 
   }
+
+  if(_predicateSymmetryLength){
+    TIME_TRACE("fmb predicate symmetry detection");
+
+    // The number of clause mappings we are willing to spend on the detection.
+    // A mapping swaps the literals of one clause and looks the result up in
+    // a hash set, which is cheaper than grounding that clause for a single
+    // model size. Candidate pairs only map the clauses their predicates occur
+    // in, so the budget allows for many pairs on problems with thousands of
+    // clauses while keeping the detection well below the cost of the first
+    // model sizes. It does not depend on fmbsp, which only bounds the length
+    // of the lex-leader constraints added for the detected symmetries.
+    static const unsigned PREDICATE_SYMMETRY_BUDGET = 1000000;
+
+    PredicateSymmetry symmetry(_clauses,_groundClauses,del_p,_sortedSignature,PREDICATE_SYMMETRY_BUDGET);
+    _symmetricPredicates = symmetry.orbits();
+    env.statistics->fmbPredicateSymmetryChecks = symmetry.checksPerformed();
+    for(unsigned o=0;o<_symmetricPredicates.size();o++){
+      env.statistics->fmbSymmetricPredicates += _symmetricPredicates[o].size();
+#if VTRACE_FMB
+      cout << "Interchangeable predicates:";
+      for(unsigned i=0;i<_symmetricPredicates[o].size();i++){
+        cout << " " << env.signature->predicateName(_symmetricPredicates[o][i]);
+      }
+      cout << endl;
+#endif
+    }
+  }
 } // init()
 
 void FiniteModelBuilder::addGroundClauses()
@@ -1362,6 +1415,54 @@ void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
 
 }
 
+unsigned FiniteModelBuilder::predicateSymmetryChainLength(unsigned p)
+{
+  CALL("FiniteModelBuilder::predicateSymmetryChainLength");
+
+  const DArray<unsigned>& p_signature = _sortedSignature->predicateSignatures[p];
+  unsigned len = 1;
+  for(unsigned i=0;i<p_signature.size() && len<_predicateSymmetryLength;i++){
+    len *= _sortModelSizes[p_signature[i]];
+  }
+  return min(len,_predicateSymmetryLength);
+}
+
+/**
+ * For neighbours p and q of a group of interchangeable predicates require
+ * that the ground atoms of p are lexicographically not greater than those
+ * of q when compared in the order of their SAT variables. As p and q have
+ * the same sorted signature, the k-th atom of p corresponds to the k-th atom of q.
+ * See PredicateSymmetry::lexLeaderClauses for the encoding.
+ *
+ * Swapping p and q preserves the clause set and the other symmetry axioms
+ * only mention function symbols, so some model always satisfies these.
+ */
+void FiniteModelBuilder::addPredicateSymmetryAxioms()
+{
+  CALL("FiniteModelBuilder::addPredicateSymmetryAxioms");
+
+  static SATClauseStack satClauses;
+  unsigned aux = predicateSymmetry_offset;
+
+  for(unsigned o=0;o<_symmetricPredicates.size();o++){
+    const Stack<unsigned>& orbit = _symmetricPredicates[o];
+    for(unsigned i=0;i+1<orbit.size();i++){
+      unsigned p = orbit[i];
+      unsigned q = orbit[i+1];
+      ASS_L(p_offsets[p],p_offsets[q]);
+
+      unsigned len = predicateSymmetryChainLength(p);
+      satClauses.reset();
+      PredicateSymmetry::lexLeaderClauses(p_offsets[p],p_offsets[q],len,aux,satClauses);
+      for(unsigned j=0;j<satClauses.size();j++){
+        addSATClause(satClauses[j]);
+      }
+      env.statistics->fmbPredicateSymmetryClauses += satClauses.size();
+      aux += len-1;
+    }
+  }
+}
+
 void FiniteModelBuilder::addUseModelSize(unsigned size)
 {
   CALL("FiniteModelBuilder::addUseModelSize");
@@ -1660,6 +1761,7 @@ MainLoopResult FiniteModelBuilder::runImpl()
     cout << "SYM DEFS" << endl;
 #endif
     addNewSymmetryAxioms();
+    addPredicateSymmetryAxioms();
     
 #if VTRACE_FMB
     cout << "TOTAL DEFS" << endl;
@@ -1674,6 +1776,7 @@ MainLoopResult FiniteModelBuilder::runImpl()
     //TODO consider adding clauses directly to SAT solver in new interface?
     // pass clauses and assumption to SAT Solver
     SATSolver::Status satResult;
+    unsigned clauseSetSize;
     {
       if (_opt.randomTraversals()) {
         TIME_TRACE(TimeTrace::SHUFFLING);
@@ -1683,6 +1786,15 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
       _solver->addClausesIter(pvi(SATClauseStack::ConstIterator(_clausesToBeAdded)));
 
+      // the solver keeps its own copy of the literals,
+      // so the clauses can be released before solving
+      clauseSetSize = _clausesToBeAdded.size();
+      SATClauseStack::Iterator it(_clausesToBeAdded);
+      while (it.hasNext()) {
+        it.next()->destroy();
+      }
+      _clausesToBeAdded.reset();
+
       satResult = SATSolver::UNKNOWN;
       env.statistics->phase = Statistics::FMB_SOLVING;
 
@@ -1750,17 +1862,8 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
     static unsigned numberOfSatCalls = 0;
     numberOfSatCalls++;
-    unsigned clauseSetSize = _clausesToBeAdded.size();
     unsigned weight = clauseSetSize;
 
-    // destroy the clauses
-    SATClauseStack::Iterator it(_clausesToBeAdded);
-    while (it.hasNext()) {
-      it.next()->destroy();
-    }
-    // but the container needs to be empty for the next round in any case
-    _clausesToBeAdded.reset();
-
     {
       // _solver->explicitlyMinimizedFailedAssumptions(false,true); // TODO: try adding this in
       const SATLiteralStack& failed = _solver->failedAssumptions();
@@ -111,6 +111,11 @@ private:
       }
     }
   }
+  // Add lex-leader constraints for the interchangeable predicates in _symmetricPredicates
+  void addPredicateSymmetryAxioms();
+  // The number of positions compared by the lex-leader constraint for p and its successor
+  unsigned predicateSymmetryChainLength(unsigned p);
+
   // Add the constraint that some term is allocated to the model size
   // Based on the assumption that all previous model sizes have been shown to be insufficient
   void addUseModelSize(unsigned size);
@@ -128,6 +133,10 @@ private:
   void createSymmetryOrdering();
   // The per-sort ordering of grounded terms used for symmetry breaking
   DArray<Stack<GroundedTerm>> _sortedGroundedTerms;
+  // Groups of interchangeable predicates, each sorted by predicate number
+  Stack<Stack<unsigned>> _symmetricPredicates;
+  // the first auxiliary variable of the lex-leader constraints for _symmetricPredicates
+  unsigned predicateSymmetry_offset;
 
   unsigned _curMaxVar;
   // SAT solver used to solve constraints (a new one is used for each model size)
@@ -222,6 +231,8 @@ private:
   bool _isAppropriate;
   // Option used in symmetry breaking
   float _symmetryRatio;
+  // Option used in breaking symmetries between predicates (0 means off)
+  unsigned _predicateSymmetryLength;
 
   // how often do we pick the next domain to grow by size and how often by weight (= encoding size estimate)
   unsigned _sizeWeightRatio;
@@ -0,0 +1,253 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PredicateSymmetry.cpp
+ * Implements class PredicateSymmetry.
+ */
+
+#include <algorithm>
+
+#include "Lib/Environment.hpp"
+#include "Lib/List.hpp"
+
+#include "Kernel/Signature.hpp"
+#include "Kernel/Term.hpp"
+
+#include "SAT/SATClause.hpp"
+#include "SAT/SATLiteral.hpp"
+
+#include "PredicateSymmetry.hpp"
+
+namespace FMB
+{
+
+PredicateSymmetry::PredicateSymmetry(ClauseList* clauses, ClauseList* groundClauses,
+    const DArray<unsigned>& ignored, SortedSignature* sortedSignature, unsigned checkBudget)
+ : _sortedSignature(sortedSignature), _budget(checkBudget), _checks(0)
+{
+  CALL("PredicateSymmetry::PredicateSymmetry");
+
+  unsigned preds = env.signature->predicates();
+  _occurrences.ensure(preds);
+  _posCnt.init(preds,0);
+  _negCnt.init(preds,0);
+
+  addClauses(clauses);
+  addClauses(groundClauses);
+
+  // Start from p=1 as we ignore equality
+  Stack<unsigned> candidates;
+  for(unsigned p=1;p<preds;p++){
+    if(p < ignored.size() && ignored[p]) continue;
+    // p might have been added to the signature after sort inference
+    if(p >= _sortedSignature->predicateSignatures.size()) continue;
+    if(_occurrences[p].isEmpty()) continue;
+    candidates.push(p);
+  }
+
+  // Only predicates with the same occurrence profile can be interchangeable,
+  // so we only try swaps within blocks of equal profiles
+  auto sameProfile = [this](unsigned p, unsigned q) {
+    return env.signature->predicateArity(p) == env.signature->predicateArity(q) &&
+           _posCnt[p] == _posCnt[q] && _negCnt[p] == _negCnt[q] &&
+           _occurrences[p].size() == _occurrences[q].size();
+  };
+  std::sort(candidates.begin(),candidates.end(),[this](unsigned p, unsigned q) {
+    unsigned ap = env.signature->predicateArity(p);
+    unsigned aq = env.signature->predicateArity(q);
+    if(ap != aq) return ap < aq;
+    if(_posCnt[p] != _posCnt[q]) return _posCnt[p] < _posCnt[q];
+    if(_negCnt[p] != _negCnt[q]) return _negCnt[p] < _negCnt[q];
+    if(_occurrences[p].size() != _occurrences[q].size()) return _occurrences[p].size() < _occurrences[q].size();
+    return p < q;
+  });
+
+  unsigned blockStart = 0;
+  while(blockStart < candidates.size()){
+    unsigned blockEnd = blockStart+1;
+    while(blockEnd < candidates.size() && sameProfile(candidates[blockStart],candidates[blockEnd])){
+      blockEnd++;
+    }
+
+    // within the block each predicate joins the first orbit whose representative
+    // it can be swapped with; all transpositions within an orbit are then symmetries
+    Stack<Stack<unsigned>> blockOrbits;
+    for(unsigned i=blockStart;i<blockEnd;i++){
+      unsigned p = candidates[i];
+      bool placed = false;
+      for(unsigned j=0;j<blockOrbits.size() && !placed;j++){
+        unsigned rep = blockOrbits[j][0];
+        if(sameSignature(rep,p) && isSymmetry(rep,p)){
+          blockOrbits[j].push(p);
+          placed = true;
+        }
+      }
+      if(!placed){
+        blockOrbits.push(Stack<unsigned>());
+        blockOrbits.top().push(p);
+      }
+    }
+    for(unsigned j=0;j<blockOrbits.size();j++){
+      if(blockOrbits[j].size() > 1){
+        // already sorted by predicate number, see the sort above
+        _orbits.push(blockOrbits[j]);
+      }
+    }
+
+    blockStart = blockEnd;
+  }
+}
+
+void PredicateSymmetry::addClauses(ClauseList* clauses)
+{
+  CALL("PredicateSymmetry::addClauses");
+
+  ClauseList::Iterator cit(clauses);
+  while(cit.hasNext()){
+    Clause* c = cit.next();
+    unsigned idx = _keys.size();
+    _keys.push(ClauseKey());
+    ClauseKey& key = _keys.top();
+    for(unsigned i=0;i<c->length();i++){
+      Literal* lit = (*c)[i];
+      key.push(lit);
+      unsigned p = lit->functor();
+      if(lit->isEquality()) continue;
+      if(lit->isPositive()){
+        _posCnt[p]++;
+      } else {
+        _negCnt[p]++;
+      }
+      if(_occurrences[p].isEmpty() || _occurrences[p].top() != idx){
+        _occurrences[p].push(idx);
+      }
+    }
+    sortKey(key);
+    _keySet.insert(key);
+  }
+}
+
+bool PredicateSymmetry::sameSignature(unsigned p, unsigned q)
+{
+  CALL("PredicateSymmetry::sameSignature");
+
+  const DArray<unsigned>& ps = _sortedSignature->predicateSignatures[p];
+  const DArray<unsigned>& qs = _sortedSignature->predicateSignatures[q];
+  if(ps.size() != qs.size()) return false;
+  for(unsigned i=0;i<ps.size();i++){
+    if(ps[i] != qs[i]) return false;
+  }
+  return true;
+}
+
+/**
+ * Return true if swapping @b p and @b q maps every clause onto a clause
+ * of the set. As the swap is an involution this makes it a bijection.
+ *
+ * The check is syntactic, so a clause that only occurs as a variant
+ * makes us miss the symmetry, which is safe. When the budget runs out
+ * we also answer false.
+ */
+bool PredicateSymmetry::isSymmetry(unsigned p, unsigned q)
+{
+  CALL("PredicateSymmetry::isSymmetry");
+
+  static ClauseKey swapped;
+
+  for(unsigned k=0;k<2;k++){
+    Stack<unsigned>::Iterator oit(_occurrences[k==0 ? p : q]);
+    while(oit.hasNext()){
+      if(_checks >= _budget){
+        return false;
+      }
+      _checks++;
+
+      const ClauseKey& key = _keys[oit.next()];
+      swapped.reset();
+      for(unsigned i=0;i<key.size();i++){
+        swapped.push(swap(key[i],p,q));
+      }
+      sortKey(swapped);
+      if(!_keySet.contains(swapped)){
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+Literal* PredicateSymmetry::swap(Literal* lit, unsigned p, unsigned q)
+{
+  CALL("PredicateSymmetry::swap");
+
+  if(lit->isEquality() || (lit->functor() != p && lit->functor() != q)){
+    return lit;
+  }
+  unsigned other = lit->functor() == p ? q : p;
+
+  static Stack<TermList> args;
+  args.reset();
+  for(unsigned i=0;i<lit->arity();i++){
+    args.push(*lit->nthArgument(i));
+  }
+  return Literal::create(other,lit->arity(),lit->polarity(),false,args.begin());
+}
+
+void PredicateSymmetry::sortKey(ClauseKey& key)
+{
+  std::sort(key.begin(),key.end());
+}
+
+/**
+ * Add to @b acc the clauses requiring that the @b len SAT variables starting
+ * at @b p are lexicographically not greater than the @b len variables
+ * starting at @b q, with false smaller than true.
+ *
+ * We use the encoding with an auxiliary variable a_k per position meaning
+ * that the variables before position k agree (a_0 is true and not represented,
+ * a_k for k>0 is the variable aux+k-1):
+ *
+ *   ~a_k | ~p_k | q_k
+ *   ~a_k | ~p_k | a_k+1
+ *   ~a_k |  q_k | a_k+1
+ */
+void PredicateSymmetry::lexLeaderClauses(unsigned p, unsigned q, unsigned len, unsigned aux, SATClauseStack& acc)
+{
+  CALL("PredicateSymmetry::lexLeaderClauses");
+
+  static SATLiteralStack satClauseLits;
+
+  for(unsigned k=0;k<len;k++){
+    SATLiteral pk(p+k,1);
+    SATLiteral qk(q+k,1);
+
+    satClauseLits.reset();
+    if(k>0){ satClauseLits.push(SATLiteral(aux+k-1,0)); }
+    satClauseLits.push(pk.opposite());
+    satClauseLits.push(qk);
+    acc.push(SATClause::fromStack(satClauseLits));
+
+    if(k+1==len) continue;
+
+    satClauseLits.reset();
+    if(k>0){ satClauseLits.push(SATLiteral(aux+k-1,0)); }
+    satClauseLits.push(pk.opposite());
+    satClauseLits.push(SATLiteral(aux+k,1));
+    acc.push(SATClause::fromStack(satClauseLits));
+
+    satClauseLits.reset();
+    if(k>0){ satClauseLits.push(SATLiteral(aux+k-1,0)); }
+    satClauseLits.push(qk);
+    satClauseLits.push(SATLiteral(aux+k,1));
+    acc.push(SATClause::fromStack(satClauseLits));
+  }
+}
+
+}
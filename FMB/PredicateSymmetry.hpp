@@ -0,0 +1,101 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PredicateSymmetry.hpp
+ * Detection of interchangeable predicate symbols in the flattened clause set.
+ *
+ * Two predicates p and q of the same sorted signature are interchangeable
+ * if swapping them maps the clause set onto itself. The finite model builder
+ * then only needs to look for models in which the interpretation of p is
+ * lexicographically not greater than that of q (a lex-leader constraint).
+ *
+ * Domain element symmetries are already broken by the ordering and canonicity
+ * axioms over grounded function terms. Those axioms do not mention predicates,
+ * so the two kinds of constraints can be combined safely.
+ */
+
+#ifndef __PredicateSymmetry__
+#define __PredicateSymmetry__
+
+#include "Forwards.hpp"
+
+#include "Lib/DArray.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Hash.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "SortInference.hpp"
+
+namespace FMB {
+  using namespace Kernel;
+  using namespace Lib;
+  using namespace SAT;
+
+class PredicateSymmetry {
+public:
+  CLASS_NAME(PredicateSymmetry);
+  USE_ALLOCATOR(PredicateSymmetry);
+
+  /**
+   * Predicates with @b ignored[p] set are never considered symmetric.
+   * At most @b checkBudget clauses are mapped while checking candidate swaps.
+   */
+  PredicateSymmetry(ClauseList* clauses, ClauseList* groundClauses,
+      const DArray<unsigned>& ignored, SortedSignature* sortedSignature, unsigned checkBudget);
+
+  /**
+   * Sets of pairwise interchangeable predicates, each of size at least two
+   * and sorted by predicate number (and therefore by SAT variable offset).
+   */
+  const Stack<Stack<unsigned>>& orbits() const { return _orbits; }
+
+  /** Number of clause mappings performed, at most the budget */
+  unsigned checksPerformed() const { return _checks; }
+
+  static void lexLeaderClauses(unsigned p, unsigned q, unsigned len, unsigned aux, SATClauseStack& acc);
+
+private:
+  typedef Stack<Literal*> ClauseKey;
+
+  struct ClauseKeyHash {
+    static bool equals(const ClauseKey& k1, const ClauseKey& k2) { return k1 == k2; }
+    static unsigned hash(const ClauseKey& k) { return StackHash<DefaultHash>::hash(k); }
+  };
+  struct ClauseKeyHash2 {
+    static unsigned hash(const ClauseKey& k) { return StackHash<DefaultHash>::hash(k, k.size()); }
+  };
+
+  void addClauses(ClauseList* clauses);
+  bool sameSignature(unsigned p, unsigned q);
+  bool isSymmetry(unsigned p, unsigned q);
+  static Literal* swap(Literal* lit, unsigned p, unsigned q);
+  static void sortKey(ClauseKey& key);
+
+  SortedSignature* _sortedSignature;
+  unsigned _budget;
+  unsigned _checks;
+
+  /** all the clauses as sorted stacks of their (shared) literals */
+  Stack<ClauseKey> _keys;
+  DHSet<ClauseKey,ClauseKeyHash,ClauseKeyHash2> _keySet;
+  /** for each predicate the indices into _keys of the clauses it occurs in */
+  DArray<Stack<unsigned>> _occurrences;
+  /** for each predicate the number of its positive and negative occurrences */
+  DArray<unsigned> _posCnt;
+  DArray<unsigned> _negCnt;
+
+  Stack<Stack<unsigned>> _orbits;
+};
+
+}
+
+#endif // __PredicateSymmetry__
@@ -23,6 +23,7 @@
 
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/BufferedSolver.hpp"
+#include "SAT/RecordingSolver.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
 
@@ -44,6 +45,10 @@ GroundingIndex::GroundingIndex(const Options& opt)
     default:
       ASSERTION_VIOLATION_REP(opt.satSolver());
   }
+
+  if (!opt.recordSatTrace().empty()) {
+    _solver = new RecordingSolver(_solver.release(),RecordingSolver::traceFileName(opt.recordSatTrace(),"gs"));
+  }
   
   _grounder = new Kernel::GlobalSubsumptionGrounder(_solver.ptr());
 }
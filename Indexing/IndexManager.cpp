@@ -21,6 +21,7 @@
 #include "AcyclicityIndex.hpp"
 #include "CodeTreeInterfaces.hpp"
 #include "GroundingIndex.hpp"
+#include "IntegerBoundIndex.hpp"
 #include "LiteralIndex.hpp"
 #include "LiteralSubstitutionTree.hpp"
 #include "TermIndex.hpp"
@@ -245,6 +246,11 @@ Index* IndexManager::create(IndexType t)
     isGenerating = true;
     break;
 
+  case INT_BOUND_INDEX:
+    res = new IntegerBoundIndex();
+    isGenerating = false;
+    break;
+
   case INDUCTION_TERM_INDEX:
     tis = new TermSubstitutionTree();
     res = new InductionTermIndex(tis);
@@ -63,6 +63,7 @@ enum IndexType {
   RENAMING_FORMULA_INDEX,
 
   UNIT_INT_COMPARISON_INDEX,
+  INT_BOUND_INDEX,
   INDUCTION_TERM_INDEX,
   STRUCT_INDUCTION_TERM_INDEX,
 };
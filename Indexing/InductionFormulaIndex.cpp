@@ -16,12 +16,64 @@
 
 #include "Inferences/Induction.hpp"
 
+#include "Lib/DArray.hpp"
+#include "Lib/Environment.hpp"
+
+#include "Shell/Statistics.hpp"
+
 namespace Indexing
 {
 
 using namespace Lib;
 using namespace Inferences;
 
+InductionFormulaIndex::~InductionFormulaIndex()
+{
+  CALL("InductionFormulaIndex::~InductionFormulaIndex");
+
+  decltype(_map)::Iterator it(_map);
+  unsigned long long fp;
+  while (it.hasNext()) {
+    Stack<Slot*>& slots = it.nextRef(fp);
+    while (slots.isNonEmpty()) {
+      delete slots.pop();
+    }
+  }
+}
+
+/** The finalizer of the SplitMix64 generator, a cheap bijective 64-bit mixer */
+static inline unsigned long long mix(unsigned long long x)
+{
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * Return a 64-bit fingerprint of the key that @b represent would build
+ * for the context and the bounds. The literals are shared and ground, so
+ * they are identified by their ids. The fingerprint of a set is the sum of
+ * the fingerprints of its elements, which makes it independent of the
+ * order of the literals and of the clauses, and allows us to compute it
+ * without copying and sorting the literal stacks.
+ */
+unsigned long long InductionFormulaIndex::fingerprint(const InductionContext& context, Literal* bound1, Literal* bound2)
+{
+  CALL("InductionFormulaIndex::fingerprint");
+
+  unsigned long long res = 0;
+  for (const auto& kv : context._cls) {
+    unsigned long long group = kv.second.size();
+    for (const auto& lit : kv.second) {
+      group += mix(lit->getId());
+    }
+    res += mix(group);
+  }
+  res = mix(res ^ (bound1 ? bound1->getId()+1 : 0));
+  return mix(res ^ (bound2 ? bound2->getId()+1 : 0));
+}
+
 Key InductionFormulaIndex::represent(const InductionContext& context)
 {
   // all literals are ground and they are unique for
@@ -43,6 +95,49 @@ Key InductionFormulaIndex::represent(const InductionContext& context)
   return k;
 }
 
+/**
+ * Return true if @b key is the key that @b represent would build for the
+ * context and the bounds. Instead of building that key, each clause group
+ * of the context is matched with a yet unmatched group of the key of the
+ * same size that contains all its literals. The groups of the key are
+ * sorted, so the membership is checked by binary search.
+ */
+bool InductionFormulaIndex::matches(const Key& key, const InductionContext& context, Literal* bound1, Literal* bound2)
+{
+  CALL("InductionFormulaIndex::matches");
+
+  if (key.second.first != bound1 || key.second.second != bound2 || key.first.size() != context._cls.size()) {
+    return false;
+  }
+  static DArray<bool> matched;
+  matched.init(key.first.size(), false);
+  for (const auto& kv : context._cls) {
+    const LiteralStack& group = kv.second;
+    unsigned i = 0;
+    for (; i < key.first.size(); i++) {
+      const LiteralStack& kgroup = key.first[i];
+      if (matched[i] || kgroup.size() != group.size()) {
+        continue;
+      }
+      bool contained = true;
+      for (Literal* lit : group) {
+        if (!binary_search(kgroup.begin(), kgroup.end(), lit)) {
+          contained = false;
+          break;
+        }
+      }
+      if (contained) {
+        break;
+      }
+    }
+    if (i == key.first.size()) {
+      return false;
+    }
+    matched[i] = true;
+  }
+  return true;
+}
+
 /**
  * Index an induction context or give back the entry for it.
  * @param context contains the relevant parts uniquely defining an induction formula conclusion
@@ -53,12 +148,31 @@ Key InductionFormulaIndex::represent(const InductionContext& context)
  */
 bool InductionFormulaIndex::findOrInsert(const InductionContext& context, Entry*& e, Literal* bound1, Literal* bound2)
 {
-  CALL("InductionFormulaIndex::insert");
+  CALL("InductionFormulaIndex::findOrInsert");
   ASS(!context._cls.empty());
+
+  Stack<Slot*>* slots;
+  bool newFingerprint = _map.getValuePtr(fingerprint(context, bound1, bound2), slots);
+
+  if (!newFingerprint) {
+    // the fingerprints agree, so this is almost surely a duplicate,
+    // but we still need to rule out a collision
+    for (Slot* slot : *slots) {
+      if (matches(slot->key, context, bound1, bound2)) {
+        env.statistics->inductionFormulaReuse++;
+        e = &slot->entry;
+        return false;
+      }
+    }
+  }
+  // only a new slot needs the sorted key
   auto k = represent(context);
   k.second.first = bound1;
   k.second.second = bound2;
-  return _map.getValuePtr(std::move(k), e);
+  Slot* slot = new Slot(std::move(k));
+  slots->push(slot);
+  e = &slot->entry;
+  return true;
 }
 
 }
@@ -64,11 +64,31 @@ public:
     Stack<pair<ClauseStack,Substitution>> _st;
   };
 
+  ~InductionFormulaIndex();
+
   static Key represent(const Inferences::InductionContext& context);
+  static unsigned long long fingerprint(const Inferences::InductionContext& context, Literal* bound1, Literal* bound2);
 
   bool findOrInsert(const Inferences::InductionContext& context, Entry*& e, Literal* bound1 = nullptr, Literal* bound2 = nullptr);
 private:
-  DHMap<Key,Entry> _map;
+  /** An indexed context together with its induction formulas */
+  struct Slot {
+    CLASS_NAME(InductionFormulaIndex::Slot);
+    USE_ALLOCATOR(InductionFormulaIndex::Slot);
+
+    Slot(Key&& key) : key(std::move(key)) {}
+
+    Key key;
+    Entry entry;
+  };
+
+  static bool matches(const Key& key, const Inferences::InductionContext& context, Literal* bound1, Literal* bound2);
+
+  /**
+   * Slots indexed by the fingerprints of their contexts. Different
+   * contexts only share a stack in case of a fingerprint collision.
+   */
+  DHMap<unsigned long long,Stack<Slot*>> _map;
 };
 
 }
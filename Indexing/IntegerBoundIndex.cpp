@@ -0,0 +1,171 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file IntegerBoundIndex.cpp
+ * Implements class IntegerBoundIndex.
+ */
+
+#include "Lib/Environment.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Term.hpp"
+
+#include "IntegerBoundIndex.hpp"
+
+namespace Indexing
+{
+
+/**
+ * If @b lit is a ground integer comparison that bounds a non-numeral term,
+ * assign the term to @b t and return true. If @b upper is set, the literal
+ * is equivalent to t <= bound, otherwise it is equivalent to t >= bound.
+ *
+ * Numeral summands, numeral factors and unary minuses around the term are
+ * moved to the bound, so that e.g. 0 < 5 + -a gives the bound a <= 4.
+ */
+bool IntegerBoundIndex::extractBound(Literal* lit, Term*& t, IntegerConstantType& bound, bool& upper)
+{
+  CALL("IntegerBoundIndex::extractBound");
+
+  if (!lit->ground() || !theory->isInterpretedPredicate(lit, Theory::INT_LESS)) {
+    return false;
+  }
+
+  TermList side;
+  try {
+    IntegerConstantType c;
+    if (theory->tryInterpretConstant(*lit->nthArgument(0), c)) {
+      // c < side, or side <= c if negative
+      side = *lit->nthArgument(1);
+      upper = lit->isNegative();
+      bound = upper ? c : c + IntegerConstantType(1);
+    } else if (theory->tryInterpretConstant(*lit->nthArgument(1), c)) {
+      // side < c, or side >= c if negative
+      side = *lit->nthArgument(0);
+      upper = lit->isPositive();
+      bound = upper ? c - IntegerConstantType(1) : c;
+    } else {
+      return false;
+    }
+
+    for (;;) {
+      ASS(side.isTerm());
+      Term* s = side.term();
+      if (!theory->isInterpretedFunction(s)) {
+        break;
+      }
+      Interpretation itp = theory->interpretFunction(s);
+      if (itp == Theory::INT_UNARY_MINUS) {
+        side = *s->nthArgument(0);
+        bound = -bound;
+        upper = !upper;
+        continue;
+      }
+      if (itp != Theory::INT_PLUS && itp != Theory::INT_MULTIPLY) {
+        break;
+      }
+      IntegerConstantType k;
+      if (theory->tryInterpretConstant(*s->nthArgument(0), k)) {
+        side = *s->nthArgument(1);
+      } else if (theory->tryInterpretConstant(*s->nthArgument(1), k)) {
+        side = *s->nthArgument(0);
+      } else {
+        break;
+      }
+      if (itp == Theory::INT_PLUS) {
+        bound = bound - k;
+        continue;
+      }
+      if (k.isZero()) {
+        return false;
+      }
+      if (k.isNegative()) {
+        k = -k;
+        bound = -bound;
+        upper = !upper;
+      }
+      // k*s <= b iff s <= floor(b/k) and k*s >= b iff s >= ceiling(b/k)
+      bound = upper ? bound.quotientF(k) : -((-bound).quotientF(k));
+    }
+  } catch (ArithmeticException&) {
+    return false;
+  }
+
+  if (theory->isInterpretedNumber(side)) {
+    // comparisons of numerals are left to the evaluation
+    return false;
+  }
+  t = side.term();
+  return true;
+}
+
+/**
+ * Return a clause of the index whose bound implies @b lit, or 0 if there is none.
+ */
+Clause* IntegerBoundIndex::getImplyingClause(Literal* lit)
+{
+  CALL("IntegerBoundIndex::getImplyingClause");
+
+  Term* t;
+  IntegerConstantType bound;
+  bool upper;
+  if (!extractBound(lit, t, bound, upper)) {
+    return 0;
+  }
+  Bounds* bs = _bounds.findPtr(t);
+  if (!bs) {
+    return 0;
+  }
+  if (upper) {
+    // the smallest upper bound must be at most the bound of the literal
+    if (bs->upper.empty() || bs->upper.begin()->first > bound) {
+      return 0;
+    }
+    return bs->upper.begin()->second;
+  }
+  // the largest lower bound must be at least the bound of the literal
+  if (bs->lower.empty() || bs->lower.rbegin()->first < bound) {
+    return 0;
+  }
+  return bs->lower.rbegin()->second;
+}
+
+void IntegerBoundIndex::handleClause(Clause* c, bool adding)
+{
+  CALL("IntegerBoundIndex::handleClause");
+
+  TIME_TRACE("integer bound index maintenance");
+
+  if (c->length() != 1) {
+    return;
+  }
+  Term* t;
+  IntegerConstantType bound;
+  bool upper;
+  if (!extractBound((*c)[0], t, bound, upper)) {
+    return;
+  }
+
+  if (adding) {
+    Bounds* bs;
+    _bounds.getValuePtr(t, bs);
+    (upper ? bs->upper : bs->lower).insert(make_pair(bound, c));
+    return;
+  }
+
+  Bounds* bs = _bounds.findPtr(t);
+  ASS(bs);
+  (upper ? bs->upper : bs->lower).erase(make_pair(bound, c));
+  if (bs->upper.empty() && bs->lower.empty()) {
+    _bounds.remove(t);
+  }
+}
+
+}
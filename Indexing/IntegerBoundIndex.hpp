@@ -0,0 +1,69 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file IntegerBoundIndex.hpp
+ * Defines class IntegerBoundIndex.
+ */
+
+#ifndef __IntegerBoundIndex__
+#define __IntegerBoundIndex__
+
+#include "Forwards.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/STL.hpp"
+
+#include "Kernel/Theory.hpp"
+
+#include "Index.hpp"
+
+namespace Indexing {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Index of the integer bounds given by ground unit clauses.
+ *
+ * A unit clause whose literal is a ground integer comparison of a term
+ * with a numeral, possibly after moving numeral summands and factors to
+ * the other side, gives a lower or an upper bound of the term. For each
+ * term the bounds are kept ordered, so that the strongest one and the
+ * clause it comes from are available in O(log n) time.
+ */
+class IntegerBoundIndex
+: public Index
+{
+public:
+  CLASS_NAME(IntegerBoundIndex);
+  USE_ALLOCATOR(IntegerBoundIndex);
+
+  Clause* getImplyingClause(Literal* lit);
+
+  static bool extractBound(Literal* lit, Term*& t, IntegerConstantType& bound, bool& upper);
+
+protected:
+  void handleClause(Clause* c, bool adding) override;
+
+private:
+  typedef vset<pair<IntegerConstantType,Clause*>> BoundSet;
+
+  /** the lower and upper bounds of a term together with their clauses */
+  struct Bounds {
+    BoundSet lower;
+    BoundSet upper;
+  };
+
+  DHMap<Term*,Bounds> _bounds;
+};
+
+};
+
+#endif /* __IntegerBoundIndex__ */
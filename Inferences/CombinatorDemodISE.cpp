@@ -33,6 +33,9 @@ using namespace Inferences;
 
 typedef ApplicativeHelper AH; 
 
+/** maximal number of terms in the weak-head normal form cache, before it is flushed */
+static const unsigned whnfCacheSize = 1 << 16;
+
 Clause* CombinatorDemodISE::simplify(Clause* c)
 {
   CALL("CombinatorDemodISE::simplify");
@@ -176,22 +179,45 @@ bool CombinatorDemodISE::headNormalForm(TermList& t)
 {
   CALL("CombinatorDemodISE::headNormalForm");
 
+  if(t.isVar()){
+    return false;
+  }
+
+  // the same shared subterms keep occurring in new clauses,
+  // so we remember the normal forms of the reducible ones
+  Term* orig = t.term();
+  bool cacheable = orig->shared();
+  if(cacheable){
+    TermList* cached = _whnfCache.findPtr(orig);
+    if(cached){
+      env.statistics->combinatorWhnfCacheHits++;
+      t = *cached;
+      return true;
+    }
+  }
+
   static TermStack args;
   TermList head;
   
   bool modified = false;
   
   for(;;){
+    // only collect the arguments once we know that the term is a redex
+    unsigned argNum = AH::getHeadAndArgNum(t, head);
+    if(!AH::isComb(head) || AH::isUnderApplied(head, argNum)){
+      break;
+    }
     AH::getHeadAndArgs(t, head, args);
-    if(AH::isComb(head) && !AH::isUnderApplied(head, args.size())){
-      modified = true;
-      t = SKIKBO::reduce(args, head);
-    } else {
-      break; 
+    modified = true;
+    t = SKIKBO::reduce(args, head);
+  }
+
+  if(cacheable && modified){
+    if(_whnfCache.size() >= whnfCacheSize){
+      // flush the cache rather than letting it grow with the search space
+      _whnfCache.reset();
     }
+    _whnfCache.insert(orig, t);
   }
   return modified;
 }
-
-
-
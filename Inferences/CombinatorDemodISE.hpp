@@ -19,6 +19,10 @@
 #include "Forwards.hpp"
 #include "InferenceEngine.hpp"
 
+#include "Lib/DHMap.hpp"
+
+#include "Kernel/Term.hpp"
+
 namespace Inferences {
 
 class CombinatorDemodISE
@@ -33,6 +37,9 @@ public:
 private:
    TermList reduce(TermList t, unsigned& length);
    bool headNormalForm(TermList& t);
+
+   /** weak-head normal forms of the shared terms that are not in one */
+   DHMap<Term*, TermList> _whnfCache;
 };
 
 };
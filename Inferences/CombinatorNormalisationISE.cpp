@@ -171,11 +171,15 @@ bool CombinatorNormalisationISE::replaceWithSmallerCombinator(TermList& t)
   TermList head1;
   TermList head2;
   
-  TermList sort;
-  if(t.isTerm()){
-    sort = SortHelper::getResultSort(t.term());
+  // most terms are not of the shape C t1 or C t1 t2 for a combinator C,
+  // which we find out without collecting the arguments
+  unsigned argNum = AH::getHeadAndArgNum(t, head);
+  if(!AH::isComb(head) || (argNum != 1 && argNum != 2)){
+    return false;
   }
 
+  TermList sort = SortHelper::getResultSort(t.term());
+
   //cout << "The original term is " + t.toString() << endl;
 
   AH::getHeadAndArgs(t, head, args);
@@ -154,7 +154,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   SATSolverWithAssumptions& solver = _index->getSolver();
   
   // Would be nice to have this:
-  // ASS_NEQ(solver.solve(_uprOnly),SATSolver::UNSATISFIABLE);
+  // ASS_NEQ(solver.solve(_conflictBudget),SATSolver::UNSATISFIABLE);
   // But even if the last addition made the SAT solver's content unconditionally inconsistent
   // the last call to solveUnderAssumptions might have missed that
 
@@ -165,17 +165,22 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   solver.addClause(scl);
 
   // check for subsuming clause by looking for a proper subset of used assumptions
-  SATSolver::Status res = solver.solveUnderAssumptions(assumps, _uprOnly, true /* only proper subsets */);
+  SATSolver::Status res = solver.solveUnderAssumptions(assumps, _conflictBudget, true /* only proper subsets */);
+  env.statistics->globalSubsumptionCalls++;
+  if (res == SATSolver::UNKNOWN) {
+    env.statistics->globalSubsumptionBudgetExhausted++;
+  }
 
   if (res == SATSolver::UNSATISFIABLE) { 
     // it should always be UNSAT with full assumps,
-    // but we may not get that far with limited solving power (_uprOnly)    
+    // but we may not get that far with limited solving power (_conflictBudget)
 
     const SATLiteralStack& failed = solver.failedAssumptions();
 
     if (failed.size() < assumps.size()) {
       // proper subset sufficed for UNSAT - that's the interesting case
-      const SATLiteralStack& failedFinal = _explicitMinim ? solver.explicitlyMinimizedFailedAssumptions(_uprOnly,_randomizeMinim) : failed;
+      const SATLiteralStack& failedFinal = _explicitMinim ?
+          solver.explicitlyMinimizedFailedAssumptions(_conflictBudget,_randomizeMinim) : failed;
 
       static LiteralStack survivors;
       survivors.reset();
@@ -253,15 +258,37 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
 
         env.statistics->globalSubsumption++;
         ASS_L(replacement->length(), clen);
-        
+
+        adaptConflictBudget(res, true);
         return replacement;       
       }                  
     }
   }
 
+  adaptConflictBudget(res, false);
   return cl;
 }
 
+/**
+ * With the adaptive solver power, spend more conflicts while the checks
+ * keep reducing clauses and fewer when they keep running out of budget.
+ */
+void GlobalSubsumption::adaptConflictBudget(SATSolver::Status res, bool reduced)
+{
+  CALL("GlobalSubsumption::adaptConflictBudget");
+
+  static const unsigned MAX_ADAPTIVE_BUDGET = 1024;
+
+  if (!_adaptiveBudget) {
+    return;
+  }
+  if (reduced) {
+    _conflictBudget = std::min(2*_conflictBudget+1, MAX_ADAPTIVE_BUDGET);
+  } else if (res == SATSolver::UNKNOWN) {
+    _conflictBudget /= 2;
+  }
+}
+
 /**
  * Functor that extracts a clause from UnitSpec.
  */
@@ -39,7 +39,8 @@ public:
   USE_ALLOCATOR(GlobalSubsumption);
 
   GlobalSubsumption(const Options& opts) : _index(0),
-      _uprOnly(opts.globalSubsumptionSatSolverPower()==Options::GlobalSubsumptionSatSolverPower::PROPAGATION_ONLY),
+      _adaptiveBudget(opts.globalSubsumptionSatSolverPower()==Options::GlobalSubsumptionSatSolverPower::ADAPTIVE),
+      _conflictBudget(opts.globalSubsumptionSatSolverPower()==Options::GlobalSubsumptionSatSolverPower::FULL ? UINT_MAX : 0),
       _explicitMinim(opts.globalSubsumptionExplicitMinim()!=Options::GlobalSubsumptionExplicitMinim::OFF),
       _randomizeMinim(opts.globalSubsumptionExplicitMinim()==Options::GlobalSubsumptionExplicitMinim::RANDOMIZED),
       _splittingAssumps(opts.globalSubsumptionAvatarAssumptions()!= Options::GlobalSubsumptionAvatarAssumptions::OFF),
@@ -61,10 +62,19 @@ private:
       
   GroundingIndex* _index;
 
+  void adaptConflictBudget(SATSolver::Status res, bool reduced);
+
+  /**
+   * Limit the SAT solver calls by _conflictBudget and adjust it
+   * according to the outcome of the calls.
+   */
+  bool _adaptiveBudget;
+
   /**
-   * Call the SAT solver using the cheap, unit-propagation-only calls.
+   * The conflict limit of the SAT solver calls, zero means only unit propagation
+   * and UINT_MAX means no limit. Only the adaptive solver power changes it.
    */
-  bool _uprOnly;
+  unsigned _conflictBudget;
 
   /**
    * Explicitly minimize the obtained assumption set.
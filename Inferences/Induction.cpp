@@ -18,6 +18,7 @@
 
 #include "Lib/BitUtils.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
 #include "Lib/IntUnionFind.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/PairUtils.hpp"
@@ -611,25 +612,9 @@ void InductionClauseIterator::processIntegerComparison(Clause* premise, Literal*
   }
 }
 
-ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context)
+void countInductionInference(InferenceRule rule)
 {
-  CALL("InductionClauseIterator::produceClauses");
-  NewCNF cnf(0);
-  cnf.setForInduction();
-  Stack<Clause*> hyp_clauses;
-  Inference inf = NonspecificInference0(UnitInputType::AXIOM,rule);
-  unsigned maxInductionDepth = 0;
-  for (const auto& kv : context._cls) {
-    maxInductionDepth = max(maxInductionDepth,kv.first->inference().inductionDepth());
-  }
-  inf.setInductionDepth(maxInductionDepth+1);
-  FormulaUnit* fu = new FormulaUnit(hypothesis,inf);
-  if(_opt.showInduction()){
-    env.beginOutput();
-    env.out() << "[Induction] formula " << fu->toString() << endl;
-    env.endOutput();
-  }
-  cnf.clausify(NNF::ennf(fu), hyp_clauses);
+  CALL("countInductionInference");
 
   switch (rule) {
     case InferenceRule::STRUCT_INDUCTION_AXIOM:
@@ -672,10 +657,294 @@ ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, Inferen
     default:
       ;
   }
+}
 
+ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context)
+{
+  CALL("InductionClauseIterator::produceClauses");
+  NewCNF cnf(0);
+  cnf.setForInduction();
+  Stack<Clause*> hyp_clauses;
+  Inference inf = NonspecificInference0(UnitInputType::AXIOM,rule);
+  unsigned maxInductionDepth = 0;
+  for (const auto& kv : context._cls) {
+    maxInductionDepth = max(maxInductionDepth,kv.first->inference().inductionDepth());
+  }
+  inf.setInductionDepth(maxInductionDepth+1);
+  FormulaUnit* fu = new FormulaUnit(hypothesis,inf);
+  if(_opt.showInduction()){
+    env.beginOutput();
+    env.out() << "[Induction] formula " << fu->toString() << endl;
+    env.endOutput();
+  }
+  cnf.clausify(NNF::ennf(fu), hyp_clauses);
+
+  countInductionInference(rule);
   return hyp_clauses;
 }
 
+/**
+ * The clauses of an induction hypothesis in which each literal of the
+ * context is replaced by an atom of a slot predicate. The clausification
+ * only depends on the boolean structure of the context, so the clauses of
+ * any context of the same shape are obtained by replacing the slot atoms by
+ * the context literals and by renaming the Skolem functions apart.
+ *
+ * The slot predicates stay in the signature but never occur in a produced
+ * clause. They are shared by all templates of a sort, so there are only as
+ * many of them as the literals of the largest context of the sort.
+ */
+struct InductionTemplate
+{
+  CLASS_NAME(InductionTemplate);
+  USE_ALLOCATOR(InductionTemplate);
+
+  Stack<LiteralStack> clauses;
+  /**
+   * Skolem functions introduced by the clausification, the context the
+   * template was built for uses them, the other contexts rename them
+   */
+  Stack<unsigned> skolems;
+  /** true once the context the template was built for got its clauses */
+  bool skolemsUsed = false;
+  /** slot predicate for each context literal, in the order of sortedContextLiterals */
+  Stack<unsigned> slots;
+  /** bindings of the substitution returned with the clauses */
+  Stack<pair<unsigned,TermList>> bindings;
+};
+
+/**
+ * Collect the literals of @b context into @b res grouped by the clauses,
+ * with the smaller groups first, and put the shape of the context into @b key
+ */
+void sortedContextLiterals(const InductionContext& context, LiteralStack& res, Stack<unsigned>& key)
+{
+  CALL("sortedContextLiterals");
+
+  static Stack<const LiteralStack*> groups;
+  groups.reset();
+  for (const auto& kv : context._cls) {
+    groups.push(&kv.second);
+  }
+  std::sort(groups.begin(), groups.end(), [](const LiteralStack* g1, const LiteralStack* g2) {
+    return g1->size() < g2->size();
+  });
+  for (const auto& g : groups) {
+    key.push(g->size());
+    res.loadFromIterator(LiteralStack::ConstIterator(*g));
+  }
+}
+
+/**
+ * Renames the Skolem functions of an induction template apart
+ */
+class SkolemRenaming : public BottomUpTermTransformer {
+public:
+  SkolemRenaming(DHMap<unsigned,unsigned>& map) : _map(map) {}
+protected:
+  TermList transformSubterm(TermList trm) override
+  {
+    unsigned f;
+    if (trm.isTerm() && _map.find(trm.term()->functor(), f)) {
+      Term* t = trm.term();
+      return TermList(Term::create(f, t->arity(), t->args()));
+    }
+    return trm;
+  }
+private:
+  DHMap<unsigned,unsigned>& _map;
+};
+
+/**
+ * Return true if a constructor of the term algebra @b ta has a boolean argument
+ */
+bool hasBooleanArgument(TermAlgebra* ta)
+{
+  CALL("hasBooleanArgument");
+
+  for (unsigned i = 0; i < ta->nConstructors(); i++) {
+    TermAlgebraConstructor* con = ta->constructor(i);
+    for (unsigned j = 0; j < con->arity(); j++) {
+      if (con->argSort(j) == AtomicSort::boolSort()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * Build the template of the hypothesis of @b schema for contexts of the shape
+ * of @b context, or return nullptr if the clausification cannot be reused.
+ */
+InductionTemplate* buildInductionTemplate(HypothesisFn hypothesisFn, InferenceRule rule, const InductionContext& context)
+{
+  CALL("buildInductionTemplate");
+
+  TermList srt = env.signature->getFunction(context._indTerm->functor())->fnType()->result();
+  if (hasBooleanArgument(env.signature->getTermAlgebraOfSort(srt))) {
+    // the clausification would introduce Skolem predicates for the boolean
+    // arguments, and the template does not rename predicates apart
+    return nullptr;
+  }
+
+  // slot predicates are shared by the templates of the same sort
+  static DHMap<pair<TermList,unsigned>,unsigned> slotPreds;
+  Term* ph = getPlaceholderForTerm(context._indTerm);
+
+  InductionTemplate* res = new InductionTemplate();
+  InductionContext abstr(context._indTerm);
+  unsigned slot = 0;
+  for (const auto& kv : context._cls) {
+    for (unsigned i = 0; i < kv.second.size(); i++) {
+      unsigned* pred;
+      if (slotPreds.getValuePtr(make_pair(srt, slot), pred)) {
+        *pred = env.signature->addFreshPredicate(1, "ind_slot");
+        env.signature->getPredicate(*pred)->setType(OperatorType::getPredicateType({ srt }));
+      }
+      abstr.insert(kv.first, Literal::create1(*pred, true, TermList(ph)));
+      slot++;
+    }
+  }
+  // the slots have to follow the order of lits, which groups the clauses by size
+  static LiteralStack abstrLits;
+  static Stack<unsigned> key;
+  abstrLits.reset();
+  key.reset();
+  sortedContextLiterals(abstr, abstrLits, key);
+  for (const auto& l : abstrLits) {
+    res->slots.push(l->functor());
+  }
+
+  Substitution subst;
+  Formula* hypothesis = hypothesisFn(abstr, subst);
+  unsigned funs = env.signature->functions();
+  DEBUG_CODE(unsigned preds = env.signature->predicates();)
+  NewCNF cnf(0);
+  cnf.setForInduction();
+  ClauseStack cls;
+  cnf.clausify(NNF::ennf(new FormulaUnit(hypothesis, NonspecificInference0(UnitInputType::AXIOM, rule))), cls);
+  // only the Skolem functions are renamed apart
+  ASS_EQ(env.signature->predicates(), preds);
+  for (unsigned f = funs; f < env.signature->functions(); f++) {
+    res->skolems.push(f);
+  }
+  for (const auto& cl : cls) {
+    res->clauses.push(LiteralStack(cl->length()));
+    res->clauses.top().loadFromIterator(cl->iterLits());
+    // the substitution binds the variables of the conclusion
+    for (const auto& lit : res->clauses.top()) {
+      VariableIterator vit(lit);
+      while (vit.hasNext()) {
+        unsigned v = vit.next().var();
+        TermList t;
+        if (subst.findBinding(v, t)) {
+          subst.unbind(v);
+          res->bindings.push(make_pair(v, t));
+        }
+      }
+    }
+  }
+  return res;
+}
+
+/**
+ * Produce the clauses of the hypothesis of @b schema built by @b hypothesisFn
+ * for @b context. The clauses are instantiated from a template shared by the
+ * contexts of the same shape, except when the hypothesis has to be printed,
+ * the Skolems of the context are squashed or reused, the context has an atom
+ * twice, or the constructors of the sort take boolean arguments.
+ */
+ClauseStack InductionClauseIterator::produceClauses(HypothesisFn hypothesisFn, unsigned schema, InferenceRule rule, const InductionContext& context, Substitution& subst)
+{
+  CALL("InductionClauseIterator::produceClauses/2");
+
+  if (_opt.showInduction() || _opt.inductionStrengthenHypothesis() || _opt.skolemReuse()) {
+    return produceClauses(hypothesisFn(context, subst), rule, context);
+  }
+
+  static DHMap<Stack<unsigned>,InductionTemplate*> templates;
+  static LiteralStack lits;
+  static Stack<unsigned> key;
+  lits.reset();
+  key.reset();
+  TermList srt = env.signature->getFunction(context._indTerm->functor())->fnType()->result();
+  key.push(schema);
+  key.push(srt.term()->getId());
+  sortedContextLiterals(context, lits, key);
+
+  // the template treats the context literals as independent atoms, so the
+  // clausification would miss simplifications if an atom occurs twice,
+  // e.g. once positively and once negatively
+  static DHSet<Literal*> atoms;
+  atoms.reset();
+  for (const auto& lit : lits) {
+    if (!atoms.insert(Literal::positiveLiteral(lit))) {
+      return produceClauses(hypothesisFn(context, subst), rule, context);
+    }
+  }
+
+  InductionTemplate** tpl;
+  if (templates.getValuePtr(key, tpl)) {
+    *tpl = buildInductionTemplate(hypothesisFn, rule, context);
+  }
+  if (!*tpl) {
+    return produceClauses(hypothesisFn(context, subst), rule, context);
+  }
+
+  for (const auto& b : (*tpl)->bindings) {
+    subst.bind(b.first, b.second);
+  }
+
+  unsigned maxInductionDepth = 0;
+  for (const auto& kv : context._cls) {
+    maxInductionDepth = max(maxInductionDepth,kv.first->inference().inductionDepth());
+  }
+
+  static DHMap<unsigned,unsigned> skolemMap;
+  skolemMap.reset();
+  // the Skolems of the template are fresh for the first context using it
+  if ((*tpl)->skolemsUsed) {
+    for (const auto& f : (*tpl)->skolems) {
+      Signature::Symbol* sym = env.signature->getFunction(f);
+      unsigned fresh = env.signature->addSkolemFunction(sym->arity());
+      env.signature->getFunction(fresh)->setType(sym->fnType());
+      env.signature->getFunction(fresh)->markInductionSkolem();
+      env.statistics->skolemFunctions++;
+      skolemMap.insert(f, fresh);
+    }
+  }
+  (*tpl)->skolemsUsed = true;
+  SkolemRenaming renaming(skolemMap);
+  Term* ph = getPlaceholderForTerm(context._indTerm);
+
+  ClauseStack res;
+  static LiteralStack resLits;
+  for (const auto& tplLits : (*tpl)->clauses) {
+    resLits.reset();
+    for (Literal* lit : tplLits) {
+      if (skolemMap.size()) {
+        lit = renaming.transform(lit);
+      }
+      unsigned slot = 0;
+      while (slot < (*tpl)->slots.size() && (*tpl)->slots[slot] != lit->functor()) {
+        slot++;
+      }
+      if (slot < (*tpl)->slots.size()) {
+        TermReplacement tr(ph, *lit->nthArgument(0));
+        Literal* clit = tr.transform(lits[slot]);
+        lit = lit->isPositive() ? clit : Literal::complementaryLiteral(clit);
+      }
+      resLits.push(lit);
+    }
+    Inference inf = NonspecificInference0(UnitInputType::AXIOM,rule);
+    inf.setInductionDepth(maxInductionDepth+1);
+    res.push(Clause::fromStack(resLits, inf));
+  }
+  countInductionInference(rule);
+  return res;
+}
+
 // helper function to properly add bounds to integer induction contexts,
 // where the bounds are not part of the inner formula for the induction
 void InductionClauseIterator::resolveClauses(InductionContext context, InductionFormulaIndex::Entry* e, const TermQueryResult* bound1, const TermQueryResult* bound2)
@@ -1028,9 +1297,9 @@ void InductionClauseIterator::performIntInduction(const InductionContext& contex
  * and then force binary resolution on L for each resultant clause
  */
 
-void InductionClauseIterator::performStructInductionOne(const InductionContext& context, InductionFormulaIndex::Entry* e)
+Formula* structInductionOneHypothesis(const InductionContext& context, Substitution& subst)
 {
-  CALL("InductionClauseIterator::performStructInductionOne"); 
+  CALL("structInductionOneHypothesis");
 
   TermAlgebra* ta = env.signature->getTermAlgebraOfSort(env.signature->getFunction(context._indTerm->functor())->fnType()->result());
   TermList ta_sort = ta->sort();
@@ -1072,13 +1341,18 @@ void InductionClauseIterator::performStructInductionOne(const InductionContext&
   }
   ASS(formulas);
   Formula* indPremise = JunctionFormula::generalJunction(Connective::AND,formulas);
-  Substitution subst;
   auto conclusion = context.getFormulaWithSquashedSkolems(TermList(var++,false), true, var, nullptr, &subst);
-  Formula* hypothesis = new BinaryFormula(Connective::IMP,
+  return new BinaryFormula(Connective::IMP,
                             Formula::quantify(indPremise),
                             Formula::quantify(conclusion));
+}
 
-  auto cls = produceClauses(hypothesis, InferenceRule::STRUCT_INDUCTION_AXIOM, context);
+void InductionClauseIterator::performStructInductionOne(const InductionContext& context, InductionFormulaIndex::Entry* e)
+{
+  CALL("InductionClauseIterator::performStructInductionOne"); 
+
+  Substitution subst;
+  auto cls = produceClauses(structInductionOneHypothesis, 1, InferenceRule::STRUCT_INDUCTION_AXIOM, context, subst);
   e->add(std::move(cls), std::move(subst));
 }
 
@@ -1087,9 +1361,9 @@ void InductionClauseIterator::performStructInductionOne(const InductionContext&
  * We produce the clause ~L[x] \/ ?y : L[y] & !z (z subterm y -> ~L[z])
  * and perform resolution with lit L[c]
  */
-void InductionClauseIterator::performStructInductionTwo(const InductionContext& context, InductionFormulaIndex::Entry* e)
+Formula* structInductionTwoHypothesis(const InductionContext& context, Substitution& subst)
 {
-  CALL("InductionClauseIterator::performStructInductionTwo"); 
+  CALL("structInductionTwoHypothesis");
 
   TermAlgebra* ta = env.signature->getTermAlgebraOfSort(env.signature->getFunction(context._indTerm->functor())->fnType()->result());
   TermList ta_sort = ta->sort();
@@ -1149,12 +1423,17 @@ void InductionClauseIterator::performStructInductionTwo(const InductionContext&
                         formulas ? new JunctionFormula(Connective::AND,FormulaList::cons(Ly,formulas))
                                  : Ly);
 
-  Substitution subst;
   auto conclusion = context.getFormulaWithSquashedSkolems(TermList(var++, false), true, var, nullptr, &subst);
   FormulaList* orf = FormulaList::cons(exists,FormulaList::singleton(Formula::quantify(conclusion)));
-  Formula* hypothesis = new JunctionFormula(Connective::OR,orf);
+  return new JunctionFormula(Connective::OR,orf);
+}
 
-  auto cls = produceClauses(hypothesis, InferenceRule::STRUCT_INDUCTION_AXIOM, context);
+void InductionClauseIterator::performStructInductionTwo(const InductionContext& context, InductionFormulaIndex::Entry* e)
+{
+  CALL("InductionClauseIterator::performStructInductionTwo"); 
+
+  Substitution subst;
+  auto cls = produceClauses(structInductionTwoHypothesis, 2, InferenceRule::STRUCT_INDUCTION_AXIOM, context, subst);
   e->add(std::move(cls), std::move(subst));
 }
 
@@ -105,6 +105,12 @@ private:
   Formula* getFormula(TermReplacement& tr, bool opposite) const;
 };
 
+/**
+ * Builds the induction hypothesis of a schema for a context, binding
+ * the variables of the conclusion in the substitution
+ */
+typedef Formula* (*HypothesisFn)(const InductionContext& context, Substitution& subst);
+
 class ContextReplacement
   : public TermReplacement, public IteratorCore<InductionContext> {
 public:
@@ -203,6 +209,7 @@ private:
   void processIntegerComparison(Clause* premise, Literal* lit);
 
   ClauseStack produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context);
+  ClauseStack produceClauses(HypothesisFn hypothesisFn, unsigned schema, InferenceRule rule, const InductionContext& context, Substitution& subst);
   void resolveClauses(InductionContext context, InductionFormulaIndex::Entry* e, const TermQueryResult* bound1, const TermQueryResult* bound2);
   void resolveClauses(const ClauseStack& cls, const InductionContext& context, Substitution& subst, bool applySubst = false);
 
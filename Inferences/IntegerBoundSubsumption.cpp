@@ -0,0 +1,66 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file IntegerBoundSubsumption.cpp
+ * Implements class IntegerBoundSubsumption.
+ */
+
+#include "Lib/Environment.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/ColorHelper.hpp"
+
+#include "Indexing/IndexManager.hpp"
+
+#include "Saturation/SaturationAlgorithm.hpp"
+
+#include "Shell/Statistics.hpp"
+
+#include "IntegerBoundSubsumption.hpp"
+
+namespace Inferences
+{
+
+void IntegerBoundSubsumption::attach(SaturationAlgorithm* salg)
+{
+  CALL("IntegerBoundSubsumption::attach");
+  ForwardSimplificationEngine::attach(salg);
+  _index=static_cast<IntegerBoundIndex*>(
+    _salg->getIndexManager()->request(INT_BOUND_INDEX) );
+}
+
+void IntegerBoundSubsumption::detach()
+{
+  CALL("IntegerBoundSubsumption::detach");
+  _index=0;
+  _salg->getIndexManager()->release(INT_BOUND_INDEX);
+  ForwardSimplificationEngine::detach();
+}
+
+bool IntegerBoundSubsumption::perform(Clause* cl, Clause*& replacement, ClauseIterator& premises)
+{
+  CALL("IntegerBoundSubsumption::perform");
+
+  TIME_TRACE("integer bound subsumption");
+
+  unsigned clen=cl->length();
+  for(unsigned i=0;i<clen;i++) {
+    Clause* premise=_index->getImplyingClause((*cl)[i]);
+    if(!premise || premise==cl || !ColorHelper::compatible(cl->color(), premise->color())) {
+      continue;
+    }
+    env.statistics->integerBoundSubsumed++;
+    premises = pvi( getSingletonIterator(premise));
+    return true;
+  }
+  return false;
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file IntegerBoundSubsumption.hpp
+ * Defines class IntegerBoundSubsumption.
+ */
+
+#ifndef __IntegerBoundSubsumption__
+#define __IntegerBoundSubsumption__
+
+#include "Forwards.hpp"
+#include "Indexing/IntegerBoundIndex.hpp"
+
+#include "InferenceEngine.hpp"
+
+namespace Inferences {
+
+using namespace Kernel;
+using namespace Indexing;
+using namespace Saturation;
+
+/**
+ * Deletes clauses that contain a ground integer comparison implied by
+ * the bound of a unit clause, e.g. a < 5 \/ C is deleted in the presence
+ * of the unit a < 3.
+ */
+class IntegerBoundSubsumption
+: public ForwardSimplificationEngine
+{
+public:
+  CLASS_NAME(IntegerBoundSubsumption);
+  USE_ALLOCATOR(IntegerBoundSubsumption);
+
+  void attach(SaturationAlgorithm* salg) override;
+  void detach() override;
+  bool perform(Clause* cl, Clause*& replacement, ClauseIterator& premises) override;
+
+#if VDEBUG
+  void setTestIndices(const Stack<Index*>& indices) override {
+    _index = static_cast<IntegerBoundIndex*>(indices[0]);
+  }
+#endif // VDEBUG
+private:
+  IntegerBoundIndex* _index;
+};
+
+};
+
+#endif /* __IntegerBoundSubsumption__ */
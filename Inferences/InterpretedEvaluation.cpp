@@ -39,6 +39,8 @@ namespace Inferences
 using namespace Lib;
 using namespace Kernel;
 
+/** maximal number of literals in the ground evaluation cache, before it is flushed */
+static const unsigned groundCacheSize = 1 << 16;
 
 InterpretedEvaluation::InterpretedEvaluation(bool doNormalize, Ordering& ordering) :
   _simpl(new InterpretedLiteralEvaluator(doNormalize))
@@ -65,12 +67,41 @@ bool InterpretedEvaluation::simplifyLiteral(Literal* lit,
     return false;
   }
 
+  // the same ground literals keep occurring in new clauses and
+  // being shared, they always evaluate to the same result
+  bool cacheable = lit->shared() && lit->ground();
+  if(cacheable) {
+    EvaluationResult* cached = _groundCache.findPtr(lit);
+    if(cached) {
+      env.statistics->evaluationCacheHits++;
+      constant = cached->constant;
+      constantTrue = cached->constantTrue;
+      res = cached->res;
+      return cached->simplified;
+    }
+    env.statistics->evaluationCacheMisses++;
+  }
+
+  unsigned sideCondCnt = sideConditions.size();
   bool okay = _simpl->evaluate(lit, constant, res, constantTrue,sideConditions);
 
   //if(okay && lit!=res){
   //  cout << "evaluate " << lit->toString() << " to " << res->toString() << endl;
   //}
 
+  if(cacheable && sideConditions.size()==sideCondCnt) {
+    if(_groundCache.size()>=groundCacheSize) {
+      // flush the cache rather than letting it grow with the search space
+      _groundCache.reset();
+    }
+    EvaluationResult entry;
+    entry.simplified = okay;
+    entry.constant = okay && constant;
+    entry.constantTrue = okay && constant && constantTrue;
+    entry.res = okay && !constant ? res : 0;
+    _groundCache.insert(lit, entry);
+  }
+
   return okay;
 }
 
@@ -41,7 +41,17 @@ public:
 private:
   bool simplifyLiteral(Literal* lit, bool& constant, Literal*& res, bool& constantTrue,Stack<Literal*>& sideConditions);
 
+  /** outcome of the evaluation of a literal */
+  struct EvaluationResult {
+    bool simplified;
+    bool constant;
+    bool constantTrue;
+    Literal* res;
+  };
+
   InterpretedLiteralEvaluator* _simpl;
+  /** evaluation results of shared ground literals */
+  DHMap<Literal*, EvaluationResult> _groundCache;
 };
 
 };
@@ -19,6 +19,7 @@
 
 #include "Lib/System.hpp"
 #include "Lib/Environment.hpp"
+#include "Lib/Hash.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/Random.hpp"
 #include "Lib/ScopedLet.hpp"
@@ -392,7 +393,7 @@ bool IGAlgorithm::startGeneratingClause(Clause* orig, ResultSubstitution& subst,
 /**
  * Finish generating the clause started in startGeneratingClause, also updating dismatching constraints of orig if applicable.
  */
-void IGAlgorithm::finishGeneratingClause(Clause* orig, ResultSubstitution& subst, bool isQuery, Clause* otherCl,Literal* origLit, LiteralStack& genLits)
+void IGAlgorithm::finishGeneratingClause(Clause* orig, Clause* otherCl, LiteralStack& genLits)
 {
   CALL("IGAlgorithm::finishGeneratingClause");
 
@@ -433,52 +434,118 @@ void IGAlgorithm::finishGeneratingClause(Clause* orig, ResultSubstitution& subst
 /**
  * Generate instances from literal of index @c litIdx in clause @c cl,
  * using the selected literals in @c selected index.
+ *
+ * The instances are first collected for all the unifiers and only then
+ * turned into clauses, so the traversal of @c _selected is not interleaved
+ * with the variant checks and global subsumption done by addClause.
  */
 void IGAlgorithm::tryGeneratingInstances(Clause* cl, unsigned litIdx)
 {
   CALL("IGAlgorithm::tryGeneratingInstances");
 
-  TIME_TRACE("inst gen generating instances");
+  {
+    TIME_TRACE("inst gen generating instances");
+
+    Literal* lit = (*cl)[litIdx];
 
-  Literal* lit = (*cl)[litIdx];
+    SLQueryResultIterator unifs = _selected->getUnifications(lit, true, true);
+    while(unifs.hasNext()) {
+      SLQueryResult unif = unifs.next();
+      if(!isSelected(unif.literal)) {
+        deactivate(unif.clause);
+        continue;//literal is no longer selected
+      }
 
-  SLQueryResultIterator unifs = _selected->getUnifications(lit, true, true);
-  while(unifs.hasNext()) {
-    SLQueryResult unif = unifs.next();
-    if(!isSelected(unif.literal)) {
-      deactivate(unif.clause);
-      continue;//literal is no longer selected
+      static LiteralStack genLits1;
+      static LiteralStack genLits2;
+      bool properInstance1;
+      bool properInstance2;
+
+      if (startGeneratingClause(cl, *unif.substitution, true, unif.clause,lit,genLits1,properInstance1) &&
+          startGeneratingClause(unif.clause, *unif.substitution, false, cl,unif.literal,genLits2,properInstance2)) {
+
+        // dismatching test passed for both
+
+        if(unif.clause->length()==1) {
+          //we make sure the unit is added first, so that it can be used to shorten the
+          //second clause by global subsumption
+          if (properInstance2) {
+            addPendingInstance(unif.clause, cl, genLits2);
+          }
+          if (properInstance1) {
+            addPendingInstance(cl, unif.clause, genLits1);
+          }
+        } else {
+          if (properInstance1) {
+            addPendingInstance(cl, unif.clause, genLits1);
+          }
+          if (properInstance2) {
+            addPendingInstance(unif.clause, cl, genLits2);
+          }
+        }
+      }
     }
+  }
+
+  processPendingInstances();
+}
+
+void IGAlgorithm::addPendingInstance(Clause* orig, Clause* otherCl, LiteralStack& genLits)
+{
+  CALL("IGAlgorithm::addPendingInstance");
+  ASS_EQ(orig->length(),genLits.size());
+
+  PendingInstance pi;
+  pi.orig = orig;
+  pi.otherCl = otherCl;
+  pi.litsStart = _pendingLits.size();
+  _pendingInstances.push(pi);
+  _pendingLits.loadFromIterator(LiteralStack::BottomFirstIterator(genLits));
+}
 
-    static LiteralStack genLits1;
-    static LiteralStack genLits2;
-    bool properInstance1;
-    bool properInstance2;
+/**
+ * Turn the instances collected by tryGeneratingInstances into clauses.
+ *
+ * Different unifiers often give the very same instance of a clause,
+ * such repetitions are dropped before a clause is built for them.
+ */
+void IGAlgorithm::processPendingInstances()
+{
+  CALL("IGAlgorithm::processPendingInstances");
 
-    if (startGeneratingClause(cl, *unif.substitution, true, unif.clause,lit,genLits1,properInstance1) &&
-        startGeneratingClause(unif.clause, *unif.substitution, false, cl,unif.literal,genLits2,properInstance2)) {
+  // maps the hash of an instance to the first pending instance with that hash
+  static DHMap<unsigned,unsigned> firstWithHash;
+  firstWithHash.reset();
+  static LiteralStack genLits;
 
-      // dismatching test passed for both
+  for(unsigned i=0; i<_pendingInstances.size(); i++) {
+    const PendingInstance& pi = _pendingInstances[i];
+    unsigned len = pi.orig->length();
+    Literal** lits = _pendingLits.begin()+pi.litsStart;
 
-      if(unif.clause->length()==1) {
-        //we make sure the unit is added first, so that it can be used to shorten the
-        //second clause by global subsumption
-        if (properInstance2) {
-          finishGeneratingClause(unif.clause, *unif.substitution, false, cl,unif.literal,genLits2);
-        }
-        if (properInstance1) {
-          finishGeneratingClause(cl, *unif.substitution, true, unif.clause,lit,genLits1);
-        }
-      } else {
-        if (properInstance1) {
-          finishGeneratingClause(cl, *unif.substitution, true, unif.clause,lit,genLits1);
-        }
-        if (properInstance2) {
-          finishGeneratingClause(unif.clause, *unif.substitution, false, cl,unif.literal,genLits2);
-        }
+    unsigned hash = DefaultHash::hash(pi.orig);
+    for(unsigned j=0; j<len; j++) {
+      hash = HashUtils::combine(hash, DefaultHash::hash(lits[j]));
+    }
+
+    unsigned* first;
+    if(!firstWithHash.getValuePtr(hash, first, i)) {
+      const PendingInstance& prev = _pendingInstances[*first];
+      if(prev.orig==pi.orig &&
+         std::equal(lits, lits+len, _pendingLits.begin()+prev.litsStart)) {
+        env.statistics->instGenGeneratedClauses++;
+        env.statistics->instGenRedundantClauses++;
+        continue;
       }
     }
+
+    genLits.reset();
+    genLits.loadFromIterator(getArrayishObjectIterator(lits, len));
+    finishGeneratingClause(pi.orig, pi.otherCl, genLits);
   }
+
+  _pendingInstances.reset();
+  _pendingLits.reset();
 }
 
 ///**
@@ -104,7 +104,9 @@ private:
   void tryGeneratingInstances(Clause* cl, unsigned litIdx);
 
   bool startGeneratingClause(Clause* orig, ResultSubstitution& subst, bool isQuery, Clause* otherCl,Literal* origLit, LiteralStack& genLits, bool& properInstance);
-  void finishGeneratingClause(Clause* orig, ResultSubstitution& subst, bool isQuery, Clause* otherCl,Literal* origLit, LiteralStack& genLits);
+  void finishGeneratingClause(Clause* orig, Clause* otherCl, LiteralStack& genLits);
+  void addPendingInstance(Clause* orig, Clause* otherCl, LiteralStack& genLits);
+  void processPendingInstances();
 
   bool isSelected(Literal* lit);
 
@@ -166,6 +168,22 @@ private:
 
   LiteralSubstitutionTree* _selected;
 
+  /**
+   * An instance found by tryGeneratingInstances, its literals are
+   * stored in _pendingLits from litsStart on, orig->length() of them.
+   */
+  struct PendingInstance {
+    Clause* orig;
+    Clause* otherCl;
+    unsigned litsStart;
+  };
+  /**
+   * Instances collected while traversing _selected, they are turned
+   * into clauses only after the traversal has finished.
+   */
+  Stack<PendingInstance> _pendingInstances;
+  LiteralStack _pendingLits;
+
   DuplicateLiteralRemovalISE _duplicateLiteralRemoval;
   TrivialInequalitiesRemovalISE _trivialInequalityRemoval;
   TautologyDeletionISE _tautologyDeletion;
@@ -211,6 +211,25 @@ void ApplicativeHelper::getHeadAndArgs(TermList term, TermList& head, TermStack&
 }
 
 
+/**
+ * Assign to @b head the head of the applicative term @b term and return
+ * the number of arguments it is applied to. Unlike getHeadAndArgs, this
+ * only walks the spine and does not collect the arguments, so it is the
+ * cheap way to check for a redex before taking the term apart.
+ */
+unsigned ApplicativeHelper::getHeadAndArgNum(TermList term, TermList& head)
+{
+  CALL("ApplicativeHelper::getHeadAndArgNum");
+
+  unsigned argNum = 0;
+  while(term.isApplication()){
+    argNum++;
+    term = *term.term()->nthArgument(2);
+  }
+  head = term;
+  return argNum;
+}
+
 void ApplicativeHelper::getHeadAndArgs(Term* term, TermList& head, TermStack& args)
 {
   CALL("ApplicativeHelper::getHeadAndArgs/2");
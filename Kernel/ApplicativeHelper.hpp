@@ -64,6 +64,7 @@ public:
   static void getHeadAndArgs(Term* term, TermList& head, TermStack& args);  
   static void getHeadAndArgs(const Term* term, TermList& head, Deque<TermList>& args); 
   static void getHeadSortAndArgs(TermList term, TermList& head, TermList& headSort, TermStack& args); 
+  static unsigned getHeadAndArgNum(TermList term, TermList& head);
   static bool isComb(const TermList t);
   static Signature::Combinator getComb(const TermList t);
   static Signature::Proxy getProxy(const TermList t);
@@ -24,7 +24,6 @@
 #include "Lib/Int.hpp"
 #include "Lib/SharedSet.hpp"
 #include "Lib/Stack.hpp"
-#include "Lib/BitUtils.hpp"
 
 #include "Saturation/ClauseContainer.hpp"
 #include "Saturation/Splitter.hpp"
@@ -548,7 +547,7 @@ unsigned Clause::getNumeralWeight() const {
       IntegerConstantType intVal;
 
       if (theory->tryInterpretConstant(t, intVal)) {
-        int w = BitUtils::log2(Int::safeAbs(intVal.toInner())) - 1;
+        int w = static_cast<int>(intVal.log2Abs()) - 1;
         if (w > 0) {
           res += w;
         }
@@ -567,8 +566,8 @@ unsigned Clause::getNumeralWeight() const {
       if (!haveRat) {
         continue;
       }
-      int wN = BitUtils::log2(Int::safeAbs(ratVal.numerator().toInner())) - 1;
-      int wD = BitUtils::log2(Int::safeAbs(ratVal.denominator().toInner())) - 1;
+      int wN = static_cast<int>(ratVal.numerator().log2Abs()) - 1;
+      int wD = static_cast<int>(ratVal.denominator().log2Abs()) - 1;
       int v = wN + wD;
       if (v > 0) {
         res += v;
@@ -138,6 +138,11 @@ SATLiteral Grounder::groundNormalized(Literal* lit)
 {
   CALL("Grounder::groundNormalized");
 
+  SATLiteral* pslit;
+  if(!_cache.getValuePtr(lit, pslit)) {
+    return *pslit;
+  }
+
   bool isPos = lit->isPositive();
   Literal* posLit = Literal::positiveLiteral(lit);
 
@@ -145,7 +150,8 @@ SATLiteral Grounder::groundNormalized(Literal* lit)
   if(_asgn.getValuePtr(posLit, pvar)) {    
     *pvar = _satSolver->newVar();
   }
-  return SATLiteral(*pvar, isPos);
+  *pslit = SATLiteral(*pvar, isPos);
+  return *pslit;
 }
 
 LiteralIterator Grounder::groundedLits()
@@ -209,7 +215,16 @@ void GlobalSubsumptionGrounder::normalize(unsigned cnt, Literal** lits)
   if(cnt==0) { return; }
   if(cnt==1) {
     lits[0] = Renaming::normalize(lits[0]);
+    return;
+  }
+
+  // renaming does not change ground literals, so for ground
+  // clauses there is nothing to normalize
+  bool ground = true;
+  for(unsigned i=0; ground && i<cnt; i++) {
+    ground = lits[i]->ground();
   }
+  if(ground) { return; }
 
   static Stack<unsigned> litOrder;
   litOrder.reset();
@@ -57,6 +57,13 @@ private:
 
   /** Map from positive literals to SAT variable numbers */
   DHMap<Literal*, unsigned> _asgn;
+
+  /**
+   * Map from normalized literals of both polarities to their SAT literals,
+   * saves building the positive counterpart of a negative literal again
+   * each time it is grounded
+   */
+  DHMap<Literal*, SATLiteral> _cache;
   
   /** Pointer to a SATSolver instance for which the grounded clauses
    * are being prepared. Used to request new variables from the Solver.
@@ -1053,7 +1053,7 @@ InterpretedLiteralEvaluator::InterpretedLiteralEvaluator(bool doNormalize) : _no
 
   _funEvaluators.ensure(0);
   _predEvaluators.ensure(0);
-
+  updateDispatchTables();
 }
 
 InterpretedLiteralEvaluator::~InterpretedLiteralEvaluator()
@@ -1455,7 +1455,7 @@ public:
 };
 TermList InterpretedLiteralEvaluator::evaluate(TermList t) {
   CALL("InterpretedLiteralEvaluator::evaluate")
-  if (t.isTerm())
+  if (t.isTerm() && hasEvaluableSubterm(t.term()))
     t = TermList(BottomUpTermTransformer::transform(t.term()));
   return InterpretedLiteralEvaluator::transformSubterm(t);
 }
@@ -1479,7 +1479,9 @@ bool InterpretedLiteralEvaluator::evaluate(Literal* lit, bool& isConstant, Liter
                       : lit;
   DEBUG( "\t0 ==> ", resLit->toString() );
 
-  resLit = BottomUpTermTransformer::transform( resLit);
+  if (hasEvaluableSubterm(resLit)) {
+    resLit = BottomUpTermTransformer::transform( resLit);
+  }
   DEBUG( "\t1 ==> ", resLit->toString() );
 
 //   // If it can be balanced we balance it
@@ -1581,52 +1583,110 @@ TermList InterpretedLiteralEvaluator::transformSubterm(TermList trm)
 }
 
 /**
- * This searches for an Evaluator for a function
+ * Return true if a proper subterm of @b t has a function symbol with an
+ * evaluator. Otherwise the bottom-up pass cannot change any argument of
+ * @b t, so it can be skipped.
  */
-template<class Fn>
-InterpretedLiteralEvaluator::Evaluator* InterpretedLiteralEvaluator::getEvaluator(unsigned functor, DArray<Evaluator*>& evaluators, Fn canEval) 
+bool InterpretedLiteralEvaluator::hasEvaluableSubterm(Term* t)
 {
-  CALL("InterpretedLiteralEvaluator::getEvaluator");
-
-  if (functor >= evaluators.size()) {
-    unsigned oldSz = evaluators.size();
-    unsigned newSz = functor + 1 ;
-    evaluators.expand(newSz);
-    for (unsigned i=oldSz; i<newSz; i++) {
-        EvalStack::Iterator evit(_evals);
-	while (evit.hasNext()) {
-          Evaluator* ev = evit.next();
-          // we only set the evaluator if it has not yet been set
-	  if (canEval(ev, i)) {
-	    evaluators[i] = ev;
-            goto break_inner;
-	  }
-	}
-break_inner:;
+  CALL("InterpretedLiteralEvaluator::hasEvaluableSubterm");
+
+  static Stack<Term*> toDo(8);
+  toDo.reset();
+  toDo.push(t);
+  while (toDo.isNonEmpty()) {
+    Term* s = toDo.pop();
+    for (TermList* arg = s->args(); !arg->isEmpty(); arg = arg->next()) {
+      if (!arg->isTerm() || arg->term()->isSort()) {
+        continue;
+      }
+      Term* a = arg->term();
+      if (getFuncEvaluator(a->functor())) {
+        return true;
+      }
+      if (a->arity()) {
+        toDo.push(a);
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * Extend the dispatch tables so that they cover all function and predicate
+ * symbols currently in the signature. Only the interpreted symbols are
+ * offered to the evaluators, the rest cannot be evaluated and map to 0.
+ */
+void InterpretedLiteralEvaluator::updateDispatchTables()
+{
+  CALL("InterpretedLiteralEvaluator::updateDispatchTables");
+
+  fillDispatchTable(_funEvaluators, env.signature->functions(),
+      [] (unsigned i) { return theory->isInterpretedFunction(i); },
+      [] (Evaluator* ev, unsigned i) { return ev->canEvaluateFunc(i); });
+  fillDispatchTable(_predEvaluators, env.signature->predicates(),
+      [] (unsigned i) { return theory->isInterpretedPredicate(i); },
+      [] (Evaluator* ev, unsigned i) { return ev->canEvaluatePred(i); });
+}
+
+/**
+ * Extend @b evaluators to @b size symbols, assigning to each new symbol
+ * the first evaluator that can evaluate it
+ */
+template<class IsInterpreted, class CanEval>
+void InterpretedLiteralEvaluator::fillDispatchTable(DArray<Evaluator*>& evaluators, unsigned size, IsInterpreted isInterpreted, CanEval canEval)
+{
+  CALL("InterpretedLiteralEvaluator::fillDispatchTable");
+
+  unsigned oldSz = evaluators.size();
+  if (size <= oldSz) {
+    return;
+  }
+  evaluators.expand(size);
+  for (unsigned i=oldSz; i<size; i++) {
+    evaluators[i] = 0;
+    if (!isInterpreted(i)) {
+      continue;
+    }
+    EvalStack::Iterator evit(_evals);
+    while (evit.hasNext()) {
+      Evaluator* ev = evit.next();
+      if (canEval(ev, i)) {
+        evaluators[i] = ev;
+        break;
+      }
     }
   }
-  return evaluators[functor];
 }
 
 /**
- * This searches for an Evaluator for a function
+ * Return the Evaluator for a function, or 0 if it has none
  */
 InterpretedLiteralEvaluator::Evaluator* InterpretedLiteralEvaluator::getFuncEvaluator(unsigned func)
 {
   CALL("InterpretedLiteralEvaluator::getFuncEvaluator");
-   return getEvaluator(func, 
-       this->_funEvaluators, 
-       [] (Evaluator* ev, unsigned i) {return ev->canEvaluateFunc(i); });
+
+  if (func >= _funEvaluators.size()) {
+    if (func >= Term::SPECIAL_FUNCTOR_LOWER_BOUND) {
+      return 0;
+    }
+    // the symbol was added to the signature after the table was built
+    updateDispatchTables();
+  }
+  return _funEvaluators[func];
 }
 
 /**
- * This searches for an Evaluator for a predicate
+ * Return the Evaluator for a predicate, or 0 if it has none
  */
 InterpretedLiteralEvaluator::Evaluator* InterpretedLiteralEvaluator::getPredEvaluator(unsigned pred)
 {
   CALL("InterpretedLiteralEvaluator::getPredEvaluator");
-   return getEvaluator(pred, this->_predEvaluators,
-       [] (Evaluator* ev, unsigned i) {return ev->canEvaluatePred(i); });
+
+  if (pred >= _predEvaluators.size()) {
+    updateDispatchTables();
+  }
+  return _predEvaluators[pred];
 }
 
 }
@@ -55,7 +55,10 @@ protected:
   virtual TermList transformSubterm(TermList trm);
   Evaluator* getFuncEvaluator(unsigned func);
   Evaluator* getPredEvaluator(unsigned pred);
+  bool hasEvaluableSubterm(Term* t);
+  void updateDispatchTables();
   EvalStack _evals;
+  /** dispatch tables from function and predicate symbols to their evaluators */
   DArray<Evaluator*> _funEvaluators;
   DArray<Evaluator*> _predEvaluators;
 
@@ -85,8 +88,8 @@ protected:
                        Term* AmultiplyB, TermList A, TermList C, TermList& result, bool& swap, Stack<Literal*>& sideConditions);
   
 private:
-  template<class Fn>
-  Evaluator* getEvaluator(unsigned func, DArray<Evaluator*>& evaluators, Fn canEval);
+  template<class IsInterpreted, class CanEval>
+  void fillDispatchTable(DArray<Evaluator*>& evaluators, unsigned size, IsInterpreted isInterpreted, CanEval canEval);
   const bool _normalize;
 };
 
@@ -8,6 +8,10 @@
  * and in the source directory
  */
 
+#include "Lib/Map.hpp"
+
+#include "Shell/Statistics.hpp"
+
 #include "PolynomialNormalizer.hpp"
 
 #define DEBUG(...) //DBG(__VA_ARGS__)
@@ -322,9 +326,9 @@ NormalizationResult normalizeNumSort(TermList t, NormalizationResult* ts)
   DBG("out : ", out);                                                                                         \
   return out;                                                                                                 \
 
-PolyNf normalizeTerm(TypedTermList t) 
+static PolyNf normalizeTermUncached(TypedTermList t) 
 {
-  CALL("PolyNf::normalize")
+  CALL("normalizeTermUncached")
   DEBUG("normalizing ", t)
   Memo::None<TypedTermList,NormalizationResult> memo;
   struct Eval 
@@ -360,6 +364,42 @@ PolyNf normalizeTerm(TypedTermList t)
   return std::move(r).apply(RenderPolyNf{});
 }
 
+/** maximal number of entries of the normalization cache, before it is flushed */
+static const int normalizationCacheSize = 1 << 18;
+
+/**
+ * Normalize @b t, reusing the result for shared terms.
+ *
+ * The same terms occur in many clauses, so the results are cached across
+ * calls. Only shared terms are used as keys, since they are never deleted
+ * and their sort is determined by the term. To bound the memory used, the
+ * cache is flushed when it gets full.
+ */
+PolyNf normalizeTerm(TypedTermList t) 
+{
+  CALL("PolyNf::normalize")
+
+  if (t.isVar() || !t.term()->shared()) {
+    return normalizeTermUncached(t);
+  }
+  ASS_EQ(t.sort(), SortHelper::getResultSort(t.term()))
+
+  static Map<Term*, PolyNf> cache;
+  auto cached = cache.tryGet(t.term());
+  if (cached.isSome()) {
+    env.statistics->polyNormalizationCacheHits++;
+    return cached.unwrap();
+  }
+  env.statistics->polyNormalizationCacheMisses++;
+
+  if (cache.size() >= normalizationCacheSize) {
+    cache.clear();
+  }
+  auto out = normalizeTermUncached(t);
+  cache.insert(t.term(), out);
+  return out;
+}
+
 TermList PolyNf::denormalize() const
 { 
   CALL("PolyNf::denormalize")
@@ -306,7 +306,7 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   vstring name = value.toString();
   vstring symbolKey = name + "_n";
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (_specialFunNames.find(symbolKey,result)) {
     return result;
   }
 
@@ -319,7 +319,7 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   }
   */
   _funs.push(sym);
-  _funNames.insert(symbolKey,result);
+  _specialFunNames.insert(symbolKey,result);
   return result;
 } // Signature::addIntegerConstant
 
@@ -333,14 +333,14 @@ unsigned Signature::addIntegerConstant(const IntegerConstantType& value)
 
   vstring key = value.toString() + "_n";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_specialFunNames.find(key, result)) {
     return result;
   }
   _integers++;
   result = _funs.length();
   Symbol* sym = new IntegerSymbol(value);
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _specialFunNames.insert(key,result);
   /*
   sym->addToDistinctGroup(INTEGER_DISTINCT_GROUP,result);
   */
@@ -365,7 +365,7 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
   vstring name = value.toString();
   vstring key = name + "_q";
   unsigned result;
-  if (_funNames.find(key,result)) {
+  if (_specialFunNames.find(key,result)) {
     return result;
   }
   result = _funs.length();
@@ -377,7 +377,7 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
   sym->addToDistinctGroup(RATIONAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _specialFunNames.insert(key,result);
   return result;
 } // addRatonalConstant
 
@@ -387,13 +387,13 @@ unsigned Signature::addRationalConstant(const RationalConstantType& value)
 
   vstring key = value.toString() + "_q";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_specialFunNames.find(key, result)) {
     return result;
   }
   _rationals++;
   result = _funs.length();
   _funs.push(new RationalSymbol(value));
-  _funNames.insert(key, result);
+  _specialFunNames.insert(key, result);
   return result;
 } // Signature::addRationalConstant
 
@@ -413,7 +413,7 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   }
   vstring key = value.toString() + "_r";
   unsigned result;
-  if (_funNames.find(key,result)) {
+  if (_specialFunNames.find(key,result)) {
     return result;
   }
   result = _funs.length();
@@ -425,7 +425,7 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   sym->addToDistinctGroup(REAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _specialFunNames.insert(key,result);
   return result;
 } // addRealConstant
 
@@ -435,13 +435,13 @@ unsigned Signature::addRealConstant(const RealConstantType& value)
 
   vstring key = value.toString() + "_r";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_specialFunNames.find(key, result)) {
     return result;
   }
   _reals++;
   result = _funs.length();
   _funs.push(new RealSymbol(value));
-  _funNames.insert(key, result);
+  _specialFunNames.insert(key, result);
   return result;
 }
 
@@ -465,12 +465,12 @@ unsigned Signature::addInterpretedFunction(Interpretation interpretation, Operat
   }
 
   vstring symbolKey = name+"_i"+Int::toString(interpretation)+(Theory::isPolymorphic(interpretation) ? type->toString() : "");
-  ASS_REP(!_funNames.find(symbolKey), name);
+  ASS_REP(!_specialFunNames.find(symbolKey), name);
 
   unsigned fnNum = _funs.length();
   InterpretedSymbol* sym = new InterpretedSymbol(name, interpretation);
   _funs.push(sym);
-  _funNames.insert(symbolKey, fnNum);
+  _specialFunNames.insert(symbolKey, fnNum);
   ALWAYS(_iSymbols.insert(mi, fnNum));
 
   OperatorType* fnType = type;
@@ -503,12 +503,12 @@ unsigned Signature::addInterpretedPredicate(Interpretation interpretation, Opera
 
   // cout << "symbolKey " << symbolKey << endl;
 
-  ASS_REP(!_predNames.find(symbolKey), symbolKey);
+  ASS_REP(!_specialPredNames.find(symbolKey), symbolKey);
 
   unsigned predNum = _preds.length();
   InterpretedSymbol* sym = new InterpretedSymbol(name, interpretation);
   _preds.push(sym);
-  _predNames.insert(symbolKey,predNum);
+  _specialPredNames.insert(symbolKey,predNum);
   ALWAYS(_iSymbols.insert(mi, predNum));
   if (predNum!=0) {
     OperatorType* predType = type;
@@ -589,7 +589,7 @@ bool Signature::functionExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::functionExists");
 
-  return _funNames.find(key(name, arity));
+  return _funNames.tryGetEquivalent(SymbolKeyRef(name, arity)).isSome();
 }
 
 /**
@@ -599,7 +599,7 @@ bool Signature::predicateExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::predicateExists");
 
-  return _predNames.find(key(name, arity));
+  return _predNames.tryGetEquivalent(SymbolKeyRef(name, arity)).isSome();
 }
 
 /**
@@ -609,23 +609,22 @@ bool Signature::typeConExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::typeConExists");
 
-  return _typeConNames.find(key(name, arity));
+  return _typeConNames.tryGetEquivalent(SymbolKeyRef(name, arity)).isSome();
 }
 
 unsigned Signature::getFunctionNumber(const vstring& name, unsigned arity) const
 {
   CALL("Signature::getFunctionNumber");
 
-  ASS(_funNames.find(key(name, arity)));
-  return _funNames.get(key(name, arity));
+  return _funNames.tryGetEquivalent(SymbolKeyRef(name, arity)).unwrap();
 }
 
 bool Signature::tryGetFunctionNumber(const vstring& name, unsigned arity, unsigned& out) const
 {
   CALL("Signature::tryGetFunctionNumber");
-  auto* value = _funNames.getPtr(key(name, arity));
-  if (value != NULL) {
-    out = *value;
+  auto value = _funNames.tryGetEquivalent(SymbolKeyRef(name, arity));
+  if (value.isSome()) {
+    out = value.unwrap();
     return true;
   } else {
     return false;
@@ -635,9 +634,9 @@ bool Signature::tryGetFunctionNumber(const vstring& name, unsigned arity, unsign
 bool Signature::tryGetPredicateNumber(const vstring& name, unsigned arity, unsigned& out) const
 {
   CALL("Signature::tryGetPredicateNumber");
-  auto* value = _predNames.getPtr(key(name, arity));
-  if (value != NULL) {
-    out = *value;
+  auto value = _predNames.tryGetEquivalent(SymbolKeyRef(name, arity));
+  if (value.isSome()) {
+    out = value.unwrap();
     return true;
   } else {
     return false;
@@ -649,8 +648,7 @@ unsigned Signature::getPredicateNumber(const vstring& name, unsigned arity) cons
 {
   CALL("Signature::getPredicateNumber");
 
-  ASS(_predNames.find(key(name, arity)));
-  return _predNames.get(key(name, arity));
+  return _predNames.tryGetEquivalent(SymbolKeyRef(name, arity)).unwrap();
 }
 
 /**
@@ -670,16 +668,16 @@ unsigned Signature::addFunction (const vstring& name,
 {
   CALL("Signature::addFunction");
 
-  vstring symbolKey = key(name,arity);
-  unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  auto found = _funNames.tryGetEquivalent(SymbolKeyRef(name, arity));
+  if (found.isSome()) {
     added = false;
-    getFunction(result)->unmarkIntroduced();
-    return result;
+    getFunction(found.unwrap())->unmarkIntroduced();
+    return found.unwrap();
   }
   if (env.options->arityCheck()) {
-    unsigned prev;
-    if (_arityCheck.find(name,prev)) {
+    auto prevFound = _arityCheck.tryGet(name);
+    if (prevFound.isSome()) {
+      unsigned prev = prevFound.unwrap();
       unsigned prevArity = prev/2;
       bool isFun = prev % 2;
       USER_ERROR((vstring)"Symbol " + name +
@@ -690,9 +688,9 @@ unsigned Signature::addFunction (const vstring& name,
     _arityCheck.insert(name,2*arity+1);
   }
 
-  result = _funs.length();
+  unsigned result = _funs.length();
   _funs.push(new Symbol(name, arity, false, false, false, overflowConstant));
-  _funNames.insert(symbolKey, result);
+  _funNames.insert(SymbolKey{name, arity}, result);
   added = true;
   return result;
 } // Signature::addFunction
@@ -708,7 +706,7 @@ unsigned Signature::addStringConstant(const vstring& name)
 
   vstring symbolKey = name + "_c";
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (_specialFunNames.find(symbolKey,result)) {
     return result;
   }
 
@@ -718,7 +716,7 @@ unsigned Signature::addStringConstant(const vstring& name)
   Symbol* sym = new Symbol(quotedName,0,false,true);
   sym->addToDistinctGroup(STRING_DISTINCT_GROUP,result);
   _funs.push(sym);
-  _funNames.insert(symbolKey,result);
+  _specialFunNames.insert(symbolKey,result);
   return result;
 } // addStringConstant
 
@@ -825,17 +823,16 @@ unsigned Signature::addTypeCon (const vstring& name,
          unsigned arity,
          bool& added)
 {
-  vstring symbolKey = key(name,arity);
-  unsigned result;
-  if (_typeConNames.find(symbolKey,result)) {
+  auto found = _typeConNames.tryGetEquivalent(SymbolKeyRef(name, arity));
+  if (found.isSome()) {
     added = false;
-    return result;
+    return found.unwrap();
   }
   //TODO no arity check. Is this safe?
 
-  result = _typeCons.length();
+  unsigned result = _typeCons.length();
   _typeCons.push(new Symbol(name,arity));
-  _typeConNames.insert(symbolKey,result);
+  _typeConNames.insert(SymbolKey{name, arity},result);
   added = true;
   return result;
 }
@@ -859,16 +856,16 @@ unsigned Signature::addPredicate (const vstring& name,
 {
   CALL("Signature::addPredicate");
 
-  vstring symbolKey = key(name,arity);
-  unsigned result;
-  if (_predNames.find(symbolKey,result)) {
+  auto found = _predNames.tryGetEquivalent(SymbolKeyRef(name, arity));
+  if (found.isSome()) {
     added = false;
-    getPredicate(result)->unmarkIntroduced();
-    return result;
+    getPredicate(found.unwrap())->unmarkIntroduced();
+    return found.unwrap();
   }
   if (env.options->arityCheck()) {
-    unsigned prev;
-    if (_arityCheck.find(name,prev)) {
+    auto prevFound = _arityCheck.tryGet(name);
+    if (prevFound.isSome()) {
+      unsigned prev = prevFound.unwrap();
       unsigned prevArity = prev/2;
       bool isFun = prev % 2;
       USER_ERROR((vstring)"Symbol " + name +
@@ -879,9 +876,9 @@ unsigned Signature::addPredicate (const vstring& name,
     _arityCheck.insert(name,2*arity);
   }
 
-  result = _preds.length();
+  unsigned result = _preds.length();
   _preds.push(new Symbol(name,arity));
-  _predNames.insert(symbolKey,result);
+  _predNames.insert(SymbolKey{name, arity},result);
   added = true;
   return result;
 } // Signature::addPredicate
@@ -1050,18 +1047,6 @@ unsigned Signature::addSkolemPredicate(unsigned arity, const char* suffix)
   return p;
 } // addSkolemPredicate
 
-/**
- * Return the key "name_arity" used for hashing. This key is obtained by
- * concatenating the name, underscore character and the arity. The key is
- * created in such a way that it does not collide with special keys, such as
- * those for string constants.
- * @since 27/02/2006 Redmond
- * @author Andrei Voronkov
- */
-vstring Signature::key(const vstring& name,int arity)
-{
-  return name + '_' + Int::toString(arity);
-} // Signature::key
 
 
 /** Add a color to the symbol for interpolation and symbol elimination purposes */
@@ -532,11 +532,9 @@ class Signature
   }
 
   /** return true iff predicate of given @b name and @b arity exists. */
-  bool isPredicateName(vstring name, unsigned arity)
+  bool isPredicateName(const vstring& name, unsigned arity)
   {
-    vstring symbolKey = key(name,arity);
-    unsigned tmp;
-    return _predNames.find(symbolKey,tmp);
+    return _predNames.tryGetEquivalent(SymbolKeyRef(name, arity)).isSome();
   }
 
   void addChoiceOperator(unsigned fun){
@@ -647,8 +645,6 @@ class Signature
 
   bool hasTermAlgebras() { return !_termAlgebras.isEmpty(); }
       
-  static vstring key(const vstring& name,int arity);
-
   /** the number of string constants */
   unsigned strings() const {return _strings;}
   /** the number of integer constants */
@@ -905,6 +901,36 @@ class Signature
   static bool symbolNeedsQuoting(vstring name, bool interpreted, unsigned arity);
 
 private:
+  /** Name and arity of a symbol, the key of the symbol name tables */
+  struct SymbolKey
+  {
+    vstring name;
+    unsigned arity;
+  };
+  /**
+   * A symbol key with its hash, which only refers to the name.
+   * Looking a symbol up with it does not copy the name.
+   */
+  struct SymbolKeyRef
+  {
+    SymbolKeyRef(const vstring& name, unsigned arity)
+      : name(name), arity(arity), hash(HashUtils::combine(DefaultHash::hash(name), arity)) {}
+
+    const vstring& name;
+    unsigned arity;
+    unsigned hash;
+  };
+  struct SymbolKeyHash
+  {
+    static unsigned hash(const SymbolKey& k) { return SymbolKeyRef(k.name, k.arity).hash; }
+    static unsigned hash(const SymbolKeyRef& k) { return k.hash; }
+    static bool equals(const SymbolKey& k1, const SymbolKey& k2)
+    { return k1.arity == k2.arity && k1.name == k2.name; }
+    static bool equals(const SymbolKey& k1, const SymbolKeyRef& k2)
+    { return k1.arity == k2.arity && k1.name == k2.name; }
+  };
+  typedef Map<SymbolKey, unsigned, SymbolKeyHash> SymbolKeyMap;
+
   Stack<TermList> _dividesNvalues;
   DHMap<Term*, int> _formulaCounts;
 
@@ -922,17 +948,22 @@ private:
   Stack<Symbol*> _typeCons;
 
   DHSet<unsigned> _choiceSymbols;
+  /** Map from names and arities of functions to their numbers */
+  SymbolKeyMap _funNames;
+  /** Map from names and arities of predicates to their numbers */
+  SymbolKeyMap _predNames;
+  /** Map from names and arities of type constructors to their numbers */
+  SymbolKeyMap _typeConNames;
   /**
-   * Map from vstring "name_arity" to their numbers
+   * Map from the keys of other functions to their numbers
    *
    * String constants have key "value_c", integer constants "value_n",
-   * rational "numerator_denominator_q" and real "value_r".
+   * rational "numerator_denominator_q" and real "value_r", and interpreted
+   * functions "name_i" followed by the interpretation.
    */
-  SymbolMap _funNames;
-  /** Map from vstring "name_arity" to their numbers */
-  SymbolMap _predNames;
-  /** Map from vstring "name_arity" to their numbers */
-  SymbolMap _typeConNames;
+  SymbolMap _specialFunNames;
+  /** Map from the keys of interpreted predicates, "name_i" followed by the interpretation, to their numbers */
+  SymbolMap _specialPredNames;
   /** Map for the arity_check options: maps symbols to their arities */
   SymbolMap _arityCheck;
   /** Last number used for fresh functions and predicates */
@@ -17,8 +17,12 @@
 #include "Debug/Assertion.hpp"
 #include "Debug/Tracer.hpp"
 
+#include "Lib/BitUtils.hpp"
 #include "Lib/Environment.hpp"
+#include "Lib/Hash.hpp"
 #include "Lib/Int.hpp"
+#include "Lib/Set.hpp"
+#include "Lib/Stack.hpp"
 
 #include "Shell/Skolem.hpp"
 
@@ -29,7 +33,6 @@
 #include "Kernel/NumTraits.hpp"
 
 #include "Theory.hpp"
-#define USES_2_COMPLEMENT (~0 == -1)
 
 namespace Kernel
 {
@@ -40,13 +43,288 @@ using namespace Lib;
 // IntegerConstantType
 //
 
+namespace {
+
+typedef Stack<unsigned> Limbs;
+
+/*
+ * Arithmetic on magnitudes of big integers, stored as 32-bit limbs with the
+ * least significant limb first. Apart from intermediate results, magnitudes
+ * have no leading zero limbs, so zero is the empty stack.
+ */
+
+void trimMagnitude(Limbs& a)
+{
+  while (a.isNonEmpty() && a.top()==0) {
+    a.pop();
+  }
+}
+
+int compareMagnitudes(const Limbs& a, const Limbs& b)
+{
+  if (a.size()!=b.size()) {
+    return a.size()<b.size() ? -1 : 1;
+  }
+  for (size_t i = a.size(); i-- > 0; ) {
+    if (a[i]!=b[i]) {
+      return a[i]<b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/** res := a + b */
+void addMagnitudes(const Limbs& a, const Limbs& b, Limbs& res)
+{
+  res.reset();
+  unsigned long long carry = 0;
+  size_t len = max(a.size(), b.size());
+  for (size_t i = 0; i < len; i++) {
+    carry += (i<a.size() ? a[i] : 0ull) + (i<b.size() ? b[i] : 0ull);
+    res.push(static_cast<unsigned>(carry));
+    carry >>= 32;
+  }
+  if (carry) {
+    res.push(static_cast<unsigned>(carry));
+  }
+}
+
+/** a := a - b, where a >= b */
+void subtractMagnitude(Limbs& a, const Limbs& b)
+{
+  ASS_GE(compareMagnitudes(a, b), 0);
+
+  long long borrow = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    long long diff = static_cast<long long>(a[i]) - (i<b.size() ? b[i] : 0ll) - borrow;
+    borrow = diff < 0;
+    if (borrow) {
+      diff += 1ll << 32;
+    }
+    a[i] = static_cast<unsigned>(diff);
+  }
+  ASS_EQ(borrow, 0);
+  trimMagnitude(a);
+}
+
+/** res := a * b */
+void multiplyMagnitudes(const Limbs& a, const Limbs& b, Limbs& res)
+{
+  res.reset();
+  for (size_t i = 0; i < a.size()+b.size(); i++) {
+    res.push(0);
+  }
+  for (size_t i = 0; i < a.size(); i++) {
+    unsigned long long carry = 0;
+    for (size_t j = 0; j < b.size(); j++) {
+      carry += static_cast<unsigned long long>(a[i]) * b[j] + res[i+j];
+      res[i+j] = static_cast<unsigned>(carry);
+      carry >>= 32;
+    }
+    res[i+b.size()] = static_cast<unsigned>(carry);
+  }
+  trimMagnitude(res);
+}
+
+/** a := a * mul + add */
+void multiplyAddMagnitude(Limbs& a, unsigned mul, unsigned add)
+{
+  unsigned long long carry = add;
+  for (size_t i = 0; i < a.size(); i++) {
+    carry += static_cast<unsigned long long>(a[i]) * mul;
+    a[i] = static_cast<unsigned>(carry);
+    carry >>= 32;
+  }
+  if (carry) {
+    a.push(static_cast<unsigned>(carry));
+  }
+}
+
+/** quot := a / div, return a % div */
+unsigned divideMagnitude(const Limbs& a, unsigned div, Limbs& quot)
+{
+  ASS_NEQ(div, 0);
+
+  quot.reset();
+  for (size_t i = 0; i < a.size(); i++) {
+    quot.push(0);
+  }
+  unsigned long long rem = 0;
+  for (size_t i = a.size(); i-- > 0; ) {
+    unsigned long long cur = (rem << 32) | a[i];
+    quot[i] = static_cast<unsigned>(cur / div);
+    rem = cur % div;
+  }
+  trimMagnitude(quot);
+  return static_cast<unsigned>(rem);
+}
+
+/** quot := a / b, rem := a % b */
+void divideMagnitudes(const Limbs& a, const Limbs& b, Limbs& quot, Limbs& rem)
+{
+  ASS(b.isNonEmpty());
+
+  rem.reset();
+  if (b.size()==1) {
+    unsigned r = divideMagnitude(a, b[0], quot);
+    if (r) {
+      rem.push(r);
+    }
+    return;
+  }
+
+  // binary long division; divisors of more than one limb are rare enough
+  quot.reset();
+  for (size_t i = 0; i < a.size(); i++) {
+    quot.push(0);
+  }
+  for (size_t bit = a.size()*32; bit-- > 0; ) {
+    // rem := 2*rem + the current bit of a
+    unsigned carry = (a[bit/32] >> (bit%32)) & 1;
+    for (size_t i = 0; i < rem.size(); i++) {
+      unsigned next = rem[i] >> 31;
+      rem[i] = (rem[i] << 1) | carry;
+      carry = next;
+    }
+    if (carry) {
+      rem.push(carry);
+    }
+    if (compareMagnitudes(rem, b) >= 0) {
+      subtractMagnitude(rem, b);
+      quot[bit/32] |= 1u << (bit%32);
+    }
+  }
+  trimMagnitude(quot);
+}
+
+} // anonymous namespace
+
+/**
+ * Heap representation of an integer that does not fit into InnerType
+ */
+struct IntegerConstantType::Big
+{
+  CLASS_NAME(IntegerConstantType::Big)
+  USE_ALLOCATOR(IntegerConstantType::Big)
+
+  Big(bool negative, const Limbs& limbs) : negative(negative), limbs(limbs)
+  {
+    hash = negative;
+    for (unsigned limb : limbs) {
+      hash = HashUtils::combine(hash, limb);
+    }
+  }
+
+  bool negative;
+  /** the absolute value */
+  Limbs limbs;
+  unsigned hash;
+};
+
+struct IntegerConstantType::BigHash
+{
+  static unsigned hash(const Big* b) { return b->hash; }
+  static bool equals(const Big* b1, const Big* b2)
+  { return b1->negative==b2->negative && b1->limbs==b2->limbs; }
+};
+
+/** Store the absolute value into @b res */
+void IntegerConstantType::magnitude(Limbs& res) const
+{
+  if (_big) {
+    res = _big->limbs;
+    return;
+  }
+  res.reset();
+  long long val = _val;
+  if (val) {
+    res.push(static_cast<unsigned>(val<0 ? -val : val));
+  }
+}
+
+/**
+ * Return the integer with absolute value @b mag (which is modified)
+ * and the given sign, inline if it fits into InnerType.
+ */
+IntegerConstantType IntegerConstantType::fromMagnitude(bool negative, Limbs& mag)
+{
+  CALL("IntegerConstantType::fromMagnitude");
+
+  trimMagnitude(mag);
+  if (mag.size()<=1) {
+    long long val = mag.isEmpty() ? 0 : mag[0];
+    if (negative) {
+      val = -val;
+    }
+    if (val>=numeric_limits<InnerType>::min() && val<=numeric_limits<InnerType>::max()) {
+      return IntegerConstantType(static_cast<InnerType>(val));
+    }
+  }
+
+  static Set<Big*,BigHash> values;
+  Big* big = new Big(negative, mag);
+  Big* shared = values.insert(big);
+  if (shared!=big) {
+    delete big;
+  }
+
+  IntegerConstantType res;
+  res._val = negative ? -1 : 1;
+  res._big = shared;
+  return res;
+}
+
 IntegerConstantType::IntegerConstantType(const vstring& str)
+  : _big(nullptr)
 {
   CALL("IntegerConstantType::IntegerConstantType(vstring)");
 
-  if (!Int::stringToInt(str, _val)) {
+  if (Int::stringToInt(str, _val)) {
+    return;
+  }
+
+  // either not a number, or a number too big for InnerType
+  size_t i = 0;
+  bool negative = false;
+  if (str.size() && str[0]=='-') {
+    negative = true;
+    i++;
+  }
+  if (i==str.size()) {
     throw MachineArithmeticException();
   }
+  Limbs mag;
+  for (; i < str.size(); i++) {
+    if (str[i]<'0' || str[i]>'9') {
+      throw MachineArithmeticException();
+    }
+    multiplyAddMagnitude(mag, 10, str[i]-'0');
+  }
+  *this = fromMagnitude(negative, mag);
+}
+
+/** Return @b n1 + @b n2, or @b n1 - @b n2 if @b negate2 is true */
+IntegerConstantType IntegerConstantType::addSlow(const IntegerConstantType& n1, const IntegerConstantType& n2, bool negate2)
+{
+  CALL("IntegerConstantType::addSlow");
+
+  Limbs m1, m2;
+  n1.magnitude(m1);
+  n2.magnitude(m2);
+  bool neg1 = n1.isNegative();
+  bool neg2 = n2.isNegative()!=negate2;
+
+  if (neg1==neg2) {
+    Limbs res;
+    addMagnitudes(m1, m2, res);
+    return fromMagnitude(neg1, res);
+  }
+  if (compareMagnitudes(m1, m2)>=0) {
+    subtractMagnitude(m1, m2);
+    return fromMagnitude(neg1, m1);
+  }
+  subtractMagnitude(m2, m1);
+  return fromMagnitude(neg2, m2);
 }
 
 IntegerConstantType IntegerConstantType::operator+(const IntegerConstantType& num) const
@@ -54,10 +332,10 @@ IntegerConstantType IntegerConstantType::operator+(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator+");
 
   InnerType res;
-  if (!Int::safePlus(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safePlus(_val, num._val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+  return addSlow(*this, num, false);
 }
 
 IntegerConstantType IntegerConstantType::operator-(const IntegerConstantType& num) const
@@ -65,10 +343,10 @@ IntegerConstantType IntegerConstantType::operator-(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator-/1");
 
   InnerType res;
-  if (!Int::safeMinus(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safeMinus(_val, num._val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+  return addSlow(*this, num, true);
 }
 
 IntegerConstantType IntegerConstantType::operator-() const
@@ -76,10 +354,12 @@ IntegerConstantType IntegerConstantType::operator-() const
   CALL("IntegerConstantType::operator-/0");
 
   InnerType res;
-  if (!Int::safeUnaryMinus(_val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && Int::safeUnaryMinus(_val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+  Limbs mag;
+  magnitude(mag);
+  return fromMagnitude(!isNegative(), mag);
 }
 
 IntegerConstantType IntegerConstantType::operator*(const IntegerConstantType& num) const
@@ -87,47 +367,62 @@ IntegerConstantType IntegerConstantType::operator*(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator*");
 
   InnerType res;
-  if (!Int::safeMultiply(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safeMultiply(_val, num._val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+  Limbs m1, m2, prod;
+  magnitude(m1);
+  num.magnitude(m2);
+  multiplyMagnitudes(m1, m2, prod);
+  return fromMagnitude(isNegative()!=num.isNegative(), prod);
 }
 
-inline typename IntegerConstantType::InnerType divideOrThrow(typename IntegerConstantType::InnerType lhs, typename IntegerConstantType::InnerType rhs) {
-    typename IntegerConstantType::InnerType out;
-    if (!Int::safeDivide(lhs,rhs, out))
-      throw MachineArithmeticException();
-    return out;
+/**
+ * Divide @b n1 by the non-zero @b n2, rounding the quotient towards zero,
+ * so that the remainder has the sign of @b n1 (as the C++ operators do).
+ */
+void IntegerConstantType::divModT(const IntegerConstantType& n1, const IntegerConstantType& n2, IntegerConstantType& quot, IntegerConstantType& rem)
+{
+  CALL("IntegerConstantType::divModT");
+  ASS(!n2.isZero());
+
+  if (!n1._big && !n2._big && !(n1._val==numeric_limits<InnerType>::min() && n2._val==-1)) {
+    quot = IntegerConstantType(n1._val / n2._val);
+    rem = IntegerConstantType(n1._val % n2._val);
+    return;
+  }
+  Limbs m1, m2, q, r;
+  n1.magnitude(m1);
+  n2.magnitude(m2);
+  divideMagnitudes(m1, m2, q, r);
+  quot = fromMagnitude(n1.isNegative()!=n2.isNegative(), q);
+  rem = fromMagnitude(n1.isNegative(), r);
 }
 
-int IntegerConstantType::intDivide(const IntegerConstantType& num) const 
+IntegerConstantType IntegerConstantType::intDivide(const IntegerConstantType& num) const 
 {
-    CALL("IntegerConstantType::intDivide");
-    ASS_REP(num.divides(*this),  num.toString() + " does not divide " + this->toString() );
-    return divideOrThrow(_val, num._val);
+  CALL("IntegerConstantType::intDivide");
+  ASS_REP(num.divides(*this),  num.toString() + " does not divide " + this->toString() );
+
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  return quot;
 }
 
 IntegerConstantType IntegerConstantType::remainderE(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::remainderE");
 
-  if (num._val == 0) {
+  if (num.isZero()) {
     throw MachineArithmeticException();
   }
 
-  if (this->_val == numeric_limits<IntegerConstantType::InnerType>::min() && num._val == -1) {
-    return 0;
-  }
-
-  auto mod = IntegerConstantType(this->_val % num._val);
-  if (mod < 0) {
-    if (num._val >= 0) {
-      mod = mod + num;
-    } else {
-      mod = mod - num;
-    }
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  if (rem.isNegative()) {
+    return rem + num.abs();
   }
-  return mod;
+  return rem;
 }
 
 RationalConstantType RationalConstantType::abs() const
@@ -145,9 +440,30 @@ RealConstantType RealConstantType::abs() const
 
 IntegerConstantType IntegerConstantType::abs() const
 {
-  if (toInner() == std::numeric_limits<InnerType>::min() && USES_2_COMPLEMENT)
-    throw new MachineArithmeticException();
-  return IntegerConstantType(::std::abs(toInner()));
+  if (!_big && _val!=numeric_limits<InnerType>::min()) {
+    return IntegerConstantType(::std::abs(_val));
+  }
+  Limbs mag;
+  magnitude(mag);
+  return fromMagnitude(false, mag);
+}
+
+IntegerConstantType IntegerConstantType::gcd(const IntegerConstantType& n1, const IntegerConstantType& n2)
+{
+  CALL("IntegerConstantType::gcd");
+
+  if (!n1._big && !n2._big && n1._val!=numeric_limits<InnerType>::min() && n2._val!=numeric_limits<InnerType>::min()) {
+    return IntegerConstantType(static_cast<InnerType>(Int::gcd(n1._val, n2._val)));
+  }
+  IntegerConstantType a = n1.abs();
+  IntegerConstantType b = n2.abs();
+  while (!b.isZero()) {
+    IntegerConstantType quot, rem;
+    divModT(a, b, quot, rem);
+    a = b;
+    b = rem;
+  }
+  return a;
 }
 
 /**
@@ -158,65 +474,56 @@ IntegerConstantType IntegerConstantType::quotientE(const IntegerConstantType& nu
 { 
   CALL("IntegerConstantType::quotientE");
 
-  if (num._val == 0) {
+  if (num.isZero()) {
     throw DivByZeroException();
   }
 
-  if (this->_val == numeric_limits<IntegerConstantType::InnerType>::min() && num._val == -1) {
-    throw MachineArithmeticException();
-  }
-
-  // as in remainderE
-  auto mod = IntegerConstantType(this->_val % num._val);
-
-  // return (*this - this->remainderE(num)).intDivide(num); // the clean definition; but we don't want to subtract for small *this
-
-  if (mod < 0) {
-    // as in remainderE -- effectively adjust for the computation of the positive mod
-    if (num._val >= 0) {
-      return (*this - mod).intDivide(num)-1;
-    } else {
-      return (*this - mod).intDivide(num)+1;
-    }
-  } else {
-    if (*this < 0) { // we don't want to subtract a positive mod, counterbalance with num, adjusting with +/-1
-      if (num._val >= 0) {
-        return (*this + num - mod).intDivide(num)-1;
-      } else {
-        return (*this - num - mod).intDivide(num)+1;
-      }
-    } else {
-      return (*this - mod).intDivide(num);
-    }
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  // as in remainderE -- adjust for the computation of the positive remainder
+  if (rem.isNegative()) {
+    return num.isNegative() ? quot + 1 : quot - 1;
   }
+  return quot;
 }
 
 IntegerConstantType IntegerConstantType::quotientF(const IntegerConstantType& num) const
 { 
-  if(num.divides(*this)){
-    return IntegerConstantType(intDivide(num));
+  CALL("IntegerConstantType::quotientF");
+
+  if (num.isZero()) {
+    throw DivByZeroException();
+  }
+
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  if (!rem.isZero() && rem.isNegative()!=num.isNegative()) {
+    return quot - 1;
   }
-  return IntegerConstantType(::floor(realDivide(num)));
+  return quot;
 }
 
 IntegerConstantType IntegerConstantType::quotientT(const IntegerConstantType& num) const
 { 
-  if(num.divides(*this)){
-    return IntegerConstantType(intDivide(num));
+  CALL("IntegerConstantType::quotientT");
+
+  if (num.isZero()) {
+    throw DivByZeroException();
   }
-  return IntegerConstantType(::trunc(realDivide(num)));
+
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  return quot;
 }
 
 bool IntegerConstantType::divides(const IntegerConstantType& num) const 
 {
   CALL("IntegerConstantType:divides");
-  if (_val == 0) { return false; }
-  if (num._val == _val) { return true; }
-  if (num._val == numeric_limits<decltype(num._val)>::min() && _val == -1) {
-    return true;
-  } else {
-    return ( num._val % _val == 0);
-  }
+  if (isZero()) { return false; }
+
+  IntegerConstantType quot, rem;
+  divModT(num, *this, quot, rem);
+  return rem.isZero();
 }
 
 //TODO remove this operator. We already have 3 other ways of computing the remainder, required by the semantics of TPTP and SMTCOMP.
@@ -225,24 +532,50 @@ IntegerConstantType IntegerConstantType::operator%(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator%");
 
   //TODO: check if modulo corresponds to the TPTP semantic
-  if (num._val==0) {
+  if (num.isZero()) {
     throw DivByZeroException();
   }
-  return IntegerConstantType(_val%num._val);
+  IntegerConstantType quot, rem;
+  divModT(*this, num, quot, rem);
+  return rem;
 }
 
 bool IntegerConstantType::operator==(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::operator==");
 
-  return _val==num._val;
+  // big values are shared and never equal to inline ones
+  return _val==num._val && _big==num._big;
 }
 
 bool IntegerConstantType::operator>(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::operator>");
 
-  return _val>num._val;
+  if (!_big && !num._big) {
+    return _val>num._val;
+  }
+  if (isNegative()!=num.isNegative()) {
+    return num.isNegative();
+  }
+  int cmp = compareAbs(*this, num);
+  return isNegative() ? cmp<0 : cmp>0;
+}
+
+/** Compare the absolute values of @b n1 and @b n2, return -1, 0 or 1 */
+int IntegerConstantType::compareAbs(const IntegerConstantType& n1, const IntegerConstantType& n2)
+{
+  CALL("IntegerConstantType::compareAbs");
+
+  if (!n1._big && !n2._big) {
+    long long a1 = ::std::abs(static_cast<long long>(n1._val));
+    long long a2 = ::std::abs(static_cast<long long>(n2._val));
+    return a1<a2 ? -1 : (a1==a2 ? 0 : 1);
+  }
+  Limbs m1, m2;
+  n1.magnitude(m1);
+  n2.magnitude(m2);
+  return compareMagnitudes(m1, m2);
 }
 
 IntegerConstantType IntegerConstantType::floor(IntegerConstantType x)
@@ -257,13 +590,8 @@ IntegerConstantType IntegerConstantType::floor(RationalConstantType rat)
   if (den == IntegerConstantType(1)) {
     return num;
   }
-  /* there is a non-zero remainder for num / den */
   ASS_G(den, 0);
-  if (num >= IntegerConstantType(0)) {
-    return IntegerConstantType(num.toInner() /den.toInner());
-  } else  {
-    return IntegerConstantType(num.toInner() / den.toInner() - 1);
-  }
+  return num.quotientF(den);
 }
 
 IntegerConstantType IntegerConstantType::ceiling(IntegerConstantType x)
@@ -282,52 +610,75 @@ IntegerConstantType IntegerConstantType::ceiling(RationalConstantType rat)
   if (den == IntegerConstantType(1)) {
     return num;
   }
-  /* there is a remainder for num / den */
+  /* there is a non-zero remainder for num / den */
   ASS_G(den, 0);
-  if (num >= IntegerConstantType(0)) {
-    return IntegerConstantType(num.toInner() /den.toInner() + 1);
-  } else  {
-    return IntegerConstantType(num.toInner() / den.toInner());
-  }
+  return num.quotientF(den) + 1;
 }
 
 Comparison IntegerConstantType::comparePrecedence(IntegerConstantType n1, IntegerConstantType n2)
 {
   CALL("IntegerConstantType::comparePrecedence");
-  try {
-    if (n1 == numeric_limits<InnerType>::min()) {
-      if (n2 == numeric_limits<InnerType>::min()) {
-        return EQUAL;
-      } else {
-        return GREATER;
-      }
-    } else {
-      if (n2 == numeric_limits<InnerType>::min()) {
-        return LESS;
-      } else {
-        InnerType an1 = n1.abs().toInner();
-        InnerType an2 = n2.abs().toInner();
 
-        ASS_GE(an1,0);
-        ASS_GE(an2,0);
+  int cmp = compareAbs(n1, n2);
+  if (cmp!=0) {
+    return cmp<0 ? LESS : GREATER;
+  }
+  // compare the signed ones, making negative greater than positive
+  return n1==n2 ? EQUAL : (n1.isNegative() ? GREATER : LESS);
+}
 
-        return an1 < an2 ? LESS : (an1 == an2 ? // compare the signed ones, making negative greater than positive
-            static_cast<Comparison>(-Int::compare(n1.toInner(), n2.toInner()))
-                              : GREATER);
-      }
-    }
+double IntegerConstantType::toDouble() const
+{
+  if (!_big) {
+    return _val;
   }
-  catch(ArithmeticException&) {
-    ASSERTION_VIOLATION;
-    throw;
+  double res = 0;
+  for (size_t i = _big->limbs.size(); i-- > 0; ) {
+    res = res*4294967296.0 + _big->limbs[i];
+  }
+  return _big->negative ? -res : res;
+}
+
+unsigned IntegerConstantType::log2Abs() const
+{
+  if (!_big) {
+    return BitUtils::log2(Int::safeAbs(_val));
   }
+  return (_big->limbs.size()-1)*32 + BitUtils::log2(_big->limbs.top());
 }
 
 vstring IntegerConstantType::toString() const
 {
   CALL("IntegerConstantType::toString");
 
-  return Int::toString(_val);
+  if (!_big) {
+    return Int::toString(_val);
+  }
+
+  // split into decimal chunks of 9 digits, the least significant first
+  static const unsigned chunkBase = 1000000000u;
+  Stack<unsigned> chunks;
+  Limbs mag = _big->limbs;
+  Limbs quot;
+  while (mag.isNonEmpty()) {
+    chunks.push(divideMagnitude(mag, chunkBase, quot));
+    mag = quot;
+  }
+
+  vstring res = _big->negative ? "-" : "";
+  res += Int::toString(chunks.pop());
+  while (chunks.isNonEmpty()) {
+    vstring chunk = Int::toString(chunks.pop());
+    res += vstring(9-chunk.size(), '0') + chunk;
+  }
+  return res;
+}
+
+size_t IntegerConstantType::hash() const {
+  if (_big) {
+    return _big->hash;
+  }
+  return std::hash<decltype(_val)>{}(_val);
 }
 
 ///////////////////////
@@ -357,7 +708,7 @@ void RationalConstantType::init(InnerType num, InnerType den)
   cannonize();
 
   // Dividing by zero is bad!
-  if(_den.toInner()==0) throw DivByZeroException();
+  if(_den.isZero()) throw DivByZeroException();
 }
 
 RationalConstantType RationalConstantType::operator+(const RationalConstantType& o) const
@@ -418,11 +769,8 @@ bool RationalConstantType::operator==(const RationalConstantType& o) const
 bool RationalConstantType::operator>(const RationalConstantType& o) const
 {
   CALL("IntegerConstantType::operator>");
-  /* prevents overflows */
-  auto toLong = [](IntegerConstantType t)  -> long int
-  { return  t.toInner(); };
-
-  return toLong(_num)*toLong(o._den)>(toLong(o._num)*toLong(_den));
+  // the denominators are positive
+  return _num*o._den > o._num*_den;
 }
 
 
@@ -445,17 +793,7 @@ void RationalConstantType::cannonize()
 {
   CALL("RationalConstantType::cannonize");
 
-  unsigned gcd = Int::gcd(_num.toInner(), _den.toInner());
-  if (gcd == (unsigned)(-(long long)(numeric_limits<int>::min()))) { // we are talking about 2147483648, but I can't take minus of it's int representation!
-    ASS_EQ(_num, numeric_limits<int>::min());
-    ASS_EQ(_den, numeric_limits<int>::min());
-    _num = 1;
-    _den = 1;
-    return;
-  }
-
-  // now it's safe to treat this unsigned as signed
-  ASS_LE(gcd,(unsigned)numeric_limits<signed>::max());
+  InnerType gcd = InnerType::gcd(_num, _den);
   if (gcd!=1) {
     _num = _num.intDivide(gcd);
     _den = _den.intDivide(gcd);
@@ -628,10 +966,10 @@ vstring RealConstantType::toNiceString() const
 {
   CALL("RealConstantType::toNiceString");
 
-  if (denominator().toInner()==1) {
+  if (denominator()==1) {
     return numerator().toString()+".0";
   }
-  float frep = (float) numerator().toInner() /(float) denominator().toInner();
+  float frep = (float) (numerator().toDouble() / denominator().toDouble());
   return Int::toString(frep);
   //return toString();
 }
@@ -2206,10 +2544,6 @@ vstring Theory::tryGetInterpretedLaTeXName(unsigned func, bool pred,bool polarit
 
 }
 
-size_t IntegerConstantType::hash() const {
-  return std::hash<decltype(_val)>{}(_val);
-}
-
 size_t RationalConstantType::hash() const {
   return (denominator().hash() << 1) ^ numerator().hash();
 }
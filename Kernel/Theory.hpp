@@ -21,6 +21,7 @@
 
 #include "Lib/DHMap.hpp"
 #include "Lib/Exception.hpp"
+#include "Lib/Stack.hpp"
 
 #include "Shell/TermAlgebra.hpp"
 
@@ -54,6 +55,16 @@ public:
   DivByZeroException() : ArithmeticException("divided by zero"){} 
 };
 
+/**
+ * A class for representing integers of arbitrary size
+ *
+ * Values that fit into InnerType are stored inline and the arithmetic on them
+ * only checks for overflow. When a result does not fit, it is represented by
+ * a pointer to a shared heap object holding its magnitude (see the Big struct
+ * in Theory.cpp). There is at most one such object per value and the objects
+ * are never deleted (just as terms), so that the class stays trivially
+ * copyable and numbers can be compared by their fields.
+ */
 class IntegerConstantType
 {
 public:
@@ -62,11 +73,11 @@ public:
 
   typedef int InnerType;
 
-  IntegerConstantType() {}
+  IntegerConstantType() : _val(0), _big(nullptr) {}
   IntegerConstantType(IntegerConstantType&&) = default;
   IntegerConstantType(const IntegerConstantType&) = default;
   IntegerConstantType& operator=(const IntegerConstantType&) = default;
-  constexpr IntegerConstantType(InnerType v) : _val(v) {}
+  constexpr IntegerConstantType(InnerType v) : _val(v), _big(nullptr) {}
   explicit IntegerConstantType(const vstring& str);
 
   IntegerConstantType operator+(const IntegerConstantType& num) const;
@@ -77,10 +88,10 @@ public:
   // true if this divides num
   bool divides(const IntegerConstantType& num) const ;
   float realDivide(const IntegerConstantType& num) const { 
-    if(num._val==0) throw DivByZeroException();
-    return ((float)_val)/num._val; 
+    if(num.isZero()) throw DivByZeroException();
+    return (float)(toDouble()/num.toDouble()); 
   }
-  int intDivide(const IntegerConstantType& num) const ;  
+  IntegerConstantType intDivide(const IntegerConstantType& num) const ;  
   IntegerConstantType remainderE(const IntegerConstantType& num) const; 
   IntegerConstantType quotientE(const IntegerConstantType& num) const; 
   IntegerConstantType quotientT(const IntegerConstantType& num) const;
@@ -99,10 +110,20 @@ public:
   bool operator>=(const IntegerConstantType& o) const { return !(o>(*this)); }
   bool operator<=(const IntegerConstantType& o) const { return !((*this)>o); }
 
-  InnerType toInner() const { return _val; }
+  /** Return the value as a machine integer, throw MachineArithmeticException if it does not fit */
+  InnerType toInner() const { 
+    if (_big) throw MachineArithmeticException();
+    return _val; 
+  }
+  /** True if the value fits into InnerType */
+  bool isSmall() const { return !_big; }
+  double toDouble() const;
+  /** The binary logarithm of the absolute value rounded down, 0 for zero */
+  unsigned log2Abs() const;
 
-  bool isZero(){ return _val==0; }
-  bool isNegative(){ return _val<0; }
+  // for big values _val holds the sign (-1 or 1)
+  bool isZero() const { return _val==0; }
+  bool isNegative() const { return _val<0; }
 
   static IntegerConstantType floor(RationalConstantType rat);
   static IntegerConstantType floor(IntegerConstantType rat);
@@ -110,28 +131,40 @@ public:
   static IntegerConstantType ceiling(RationalConstantType rat);
   static IntegerConstantType ceiling(IntegerConstantType rat);
   IntegerConstantType abs() const;
+  /** The greatest common divisor of the absolute values, 1 for two zeros */
+  static IntegerConstantType gcd(const IntegerConstantType& n1, const IntegerConstantType& n2);
 
   static Comparison comparePrecedence(IntegerConstantType n1, IntegerConstantType n2);
   size_t hash() const;
 
   vstring toString() const;
 private:
+  struct Big;
+  struct BigHash;
+  typedef Stack<unsigned> Limbs;
+
+  void magnitude(Limbs& res) const;
+  static IntegerConstantType fromMagnitude(bool negative, Limbs& mag);
+  static IntegerConstantType addSlow(const IntegerConstantType& n1, const IntegerConstantType& n2, bool negate2);
+  static void divModT(const IntegerConstantType& n1, const IntegerConstantType& n2, IntegerConstantType& quot, IntegerConstantType& rem);
+  static int compareAbs(const IntegerConstantType& n1, const IntegerConstantType& n2);
+
   InnerType _val;
+  const Big* _big;
   IntegerConstantType operator/(const IntegerConstantType& num) const;
   IntegerConstantType operator%(const IntegerConstantType& num) const;
 };
 
 inline
 std::ostream& operator<< (ostream& out, const IntegerConstantType& val) {
-  return out << val.toInner();
+  return out << val.toString();
 }
 
 /**
  * A class for representing rational numbers
  *
- * The class uses IntegerConstantType to store the numerator and denominator.
- * This ensures that if there is an overflow in the operations, an exception
- * will be raised by the IntegerConstantType methods.
+ * The class uses IntegerConstantType to store the numerator and denominator,
+ * so the operations do not overflow.
  */
 struct RationalConstantType {
   typedef IntegerConstantType InnerType;
@@ -174,10 +207,10 @@ struct RationalConstantType {
   bool operator>=(const RationalConstantType& o) const { return !(o>(*this)); }
   bool operator<=(const RationalConstantType& o) const { return !((*this)>o); }
 
-  bool isZero(){ return _num.toInner()==0; } 
+  bool isZero() const { return _num.isZero(); } 
   // relies on the fact that cannonize ensures that _den>=0
-  bool isNegative() const { ASS(_den>=0); return _num.toInner() < 0; }
-  bool isPositive() const { ASS(_den>=0); return _num.toInner() > 0; }
+  bool isNegative() const { ASS(_den>=0); return _num.isNegative(); }
+  bool isPositive() const { ASS(_den>=0); return !_num.isNegative() && !_num.isZero(); }
 
   RationalConstantType abs() const;
 
@@ -222,6 +222,32 @@ public:
     return Opt();
   } // Map::find
 
+  /**
+   * Find value by @b key, which is of a different type than the stored keys.
+   * Hash must provide hash(K) (equal to the hash of the corresponding stored key)
+   * and equals(Key,K). This makes it possible to look up, say, strings without
+   * constructing a Key.
+   */
+  template<class K>
+  Option<Val&> tryGetEquivalent(K const& key) const
+  {
+    CALL("Map::tryGetEquivalent");
+    using Opt = Option<Val&>;
+
+    auto code = Hash::hash(key);
+    if (code == 0) {
+      code = 1;
+    }
+    Entry* entry;
+    for (entry = firstEntryForCode(code); entry->occupied(); entry = nextEntry(entry)) {
+      if (entry->code == code && Hash::equals(entry->key(),key)) {
+        return Opt(entry->value());
+      }
+    }
+
+    return Opt();
+  } // Map::tryGetEquivalent
+
   /**
    * Find value by the key. The result is true if a pair with this key
    * is in the map. If such a pair is found then its value is
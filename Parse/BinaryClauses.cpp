@@ -0,0 +1,609 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file BinaryClauses.cpp
+ * Implements class BinaryClauses.
+ */
+
+#include <iostream>
+
+#include "Lib/DHMap.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Int.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/OperatorType.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/SortHelper.hpp"
+#include "Kernel/Term.hpp"
+#include "Kernel/Theory.hpp"
+
+#include "Parse/TPTP.hpp"
+
+#include "BinaryClauses.hpp"
+
+namespace Parse {
+
+static const char MAGIC[] = "VBCS";
+static const unsigned VERSION = 1;
+static const unsigned FLAG_NUMBERS = 1;
+
+/** kinds of symbols in the symbol tables */
+enum SymbolKind {
+  SK_PLAIN = 0,
+  SK_INTERPRETED = 1,
+  SK_INTEGER = 2,
+  SK_RATIONAL = 3,
+  SK_REAL = 4
+};
+
+class BinaryClauses::Writer
+{
+public:
+  Writer(ostream& out) : _out(out) {}
+
+  void write(const Stack<Clause*>& clauses, bool numbers);
+private:
+  void collectSort(TermList sort);
+  void collectTerm(TermList trm);
+  void collectType(OperatorType* type, bool function);
+  unsigned localFunction(unsigned fn);
+  unsigned localPredicate(unsigned pred);
+
+  void writeUnsigned(unsigned val);
+  void writeString(const vstring& str);
+  void writeTerm(TermList trm, bool sort);
+  void writeType(OperatorType* type, bool function);
+  void writeSymbol(Signature::Symbol* sym, bool function);
+
+  ostream& _out;
+
+  /** global to local numbers of the used symbols */
+  DHMap<unsigned,unsigned> _typeConMap;
+  DHMap<unsigned,unsigned> _functionMap;
+  DHMap<unsigned,unsigned> _predicateMap;
+  /** the used symbols in the order of their local numbers */
+  Stack<unsigned> _typeCons;
+  Stack<unsigned> _functions;
+  Stack<unsigned> _predicates;
+};
+
+void BinaryClauses::write(ostream& out, const Stack<Clause*>& clauses, bool numbers)
+{
+  CALL("BinaryClauses::write");
+
+  Writer(out).write(clauses, numbers);
+}
+
+void BinaryClauses::Writer::write(const Stack<Clause*>& clauses, bool numbers)
+{
+  CALL("BinaryClauses::Writer::write");
+
+  // the equality predicate is always number 0
+  _predicates.push(0);
+  _predicateMap.insert(0, 0);
+
+  for (unsigned ci = 0; ci < clauses.size(); ci++) {
+    Clause* cl = clauses[ci];
+    for (unsigned i = 0; i < cl->length(); i++) {
+      Literal* lit = (*cl)[i];
+      if (lit->isEquality()) {
+        collectSort(SortHelper::getEqualityArgumentSort(lit));
+      }
+      else {
+        localPredicate(lit->functor());
+      }
+      for (unsigned j = 0; j < lit->arity(); j++) {
+        collectTerm(*lit->nthArgument(j));
+      }
+    }
+  }
+
+  _out.write(MAGIC, 4);
+  writeUnsigned(VERSION);
+  writeUnsigned(numbers ? FLAG_NUMBERS : 0);
+
+  writeUnsigned(_typeCons.size());
+  Stack<unsigned>::BottomFirstIterator tit(_typeCons);
+  while (tit.hasNext()) {
+    Signature::Symbol* sym = env.signature->getTypeCon(tit.next());
+    writeString(sym->name());
+    writeUnsigned(sym->arity());
+  }
+  writeUnsigned(_functions.size());
+  Stack<unsigned>::BottomFirstIterator fit(_functions);
+  while (fit.hasNext()) {
+    writeSymbol(env.signature->getFunction(fit.next()), true);
+  }
+  // equality is not written
+  writeUnsigned(_predicates.size()-1);
+  for (unsigned i = 1; i < _predicates.size(); i++) {
+    writeSymbol(env.signature->getPredicate(_predicates[i]), false);
+  }
+
+  writeUnsigned(clauses.size());
+  for (unsigned ci = 0; ci < clauses.size(); ci++) {
+    Clause* cl = clauses[ci];
+    writeUnsigned(toNumber(cl->inputType()));
+    if (numbers) {
+      writeUnsigned(cl->number());
+    }
+    writeUnsigned(cl->length());
+    for (unsigned i = 0; i < cl->length(); i++) {
+      Literal* lit = (*cl)[i];
+      writeUnsigned((_predicateMap.get(lit->functor()) << 1) | (lit->isPositive() ? 1 : 0));
+      for (unsigned j = 0; j < lit->arity(); j++) {
+        writeTerm(*lit->nthArgument(j), false);
+      }
+      if (lit->isEquality()) {
+        writeTerm(SortHelper::getEqualityArgumentSort(lit), true);
+      }
+    }
+  }
+  _out.flush();
+} // BinaryClauses::Writer::write
+
+void BinaryClauses::Writer::collectSort(TermList sort)
+{
+  CALL("BinaryClauses::Writer::collectSort");
+
+  static Stack<TermList> todo;
+  ASS(todo.isEmpty());
+
+  todo.push(sort);
+  while (todo.isNonEmpty()) {
+    TermList s = todo.pop();
+    if (s.isVar()) {
+      USER_ERROR("Binary clause output does not support polymorphic sorts");
+    }
+    Term* t = s.term();
+    if (!_typeConMap.find(t->functor())) {
+      _typeConMap.insert(t->functor(), _typeCons.size());
+      _typeCons.push(t->functor());
+    }
+    for (unsigned i = 0; i < t->arity(); i++) {
+      todo.push(*t->nthArgument(i));
+    }
+  }
+} // BinaryClauses::Writer::collectSort
+
+void BinaryClauses::Writer::collectTerm(TermList trm)
+{
+  CALL("BinaryClauses::Writer::collectTerm");
+
+  static Stack<TermList> todo;
+  ASS(todo.isEmpty());
+
+  todo.push(trm);
+  while (todo.isNonEmpty()) {
+    TermList s = todo.pop();
+    if (s.isVar()) {
+      continue;
+    }
+    Term* t = s.term();
+    localFunction(t->functor());
+    for (unsigned i = 0; i < t->arity(); i++) {
+      todo.push(*t->nthArgument(i));
+    }
+  }
+} // BinaryClauses::Writer::collectTerm
+
+void BinaryClauses::Writer::collectType(OperatorType* type, bool function)
+{
+  CALL("BinaryClauses::Writer::collectType");
+
+  if (type->numTypeArguments()) {
+    USER_ERROR("Binary clause output does not support polymorphic symbols");
+  }
+  for (unsigned i = 0; i < type->arity(); i++) {
+    collectSort(type->arg(i));
+  }
+  if (function) {
+    collectSort(type->result());
+  }
+}
+
+/**
+ * Return the local number of function @c fn, adding it to the table if needed.
+ */
+unsigned BinaryClauses::Writer::localFunction(unsigned fn)
+{
+  CALL("BinaryClauses::Writer::localFunction");
+
+  unsigned* res;
+  if (_functionMap.getValuePtr(fn, res)) {
+    *res = _functions.size();
+    _functions.push(fn);
+    collectType(env.signature->getFunction(fn)->fnType(), true);
+  }
+  return *res;
+}
+
+/**
+ * Return the local number of predicate @c pred, adding it to the table if needed.
+ */
+unsigned BinaryClauses::Writer::localPredicate(unsigned pred)
+{
+  CALL("BinaryClauses::Writer::localPredicate");
+
+  unsigned* res;
+  if (_predicateMap.getValuePtr(pred, res)) {
+    *res = _predicates.size();
+    _predicates.push(pred);
+    collectType(env.signature->getPredicate(pred)->predType(), false);
+  }
+  return *res;
+}
+
+void BinaryClauses::Writer::writeUnsigned(unsigned val)
+{
+  while (val >= 0x80) {
+    _out.put(static_cast<char>((val & 0x7f) | 0x80));
+    val >>= 7;
+  }
+  _out.put(static_cast<char>(val));
+}
+
+void BinaryClauses::Writer::writeString(const vstring& str)
+{
+  writeUnsigned(str.size());
+  _out.write(str.data(), str.size());
+}
+
+/**
+ * Write term (or sort, if @c sort is true) @c trm in prefix order.
+ */
+void BinaryClauses::Writer::writeTerm(TermList trm, bool sort)
+{
+  CALL("BinaryClauses::Writer::writeTerm");
+
+  static Stack<TermList> todo;
+  ASS(todo.isEmpty());
+
+  todo.push(trm);
+  while (todo.isNonEmpty()) {
+    TermList s = todo.pop();
+    if (s.isVar()) {
+      writeUnsigned((s.var() << 1) | 1);
+      continue;
+    }
+    Term* t = s.term();
+    writeUnsigned((sort ? _typeConMap.get(t->functor()) : _functionMap.get(t->functor())) << 1);
+    for (unsigned i = t->arity(); i > 0; i--) {
+      todo.push(*t->nthArgument(i-1));
+    }
+  }
+}
+
+void BinaryClauses::Writer::writeType(OperatorType* type, bool function)
+{
+  CALL("BinaryClauses::Writer::writeType");
+
+  writeUnsigned(type->arity());
+  for (unsigned i = 0; i < type->arity(); i++) {
+    writeTerm(type->arg(i), true);
+  }
+  if (function) {
+    writeTerm(type->result(), true);
+  }
+}
+
+void BinaryClauses::Writer::writeSymbol(Signature::Symbol* sym, bool function)
+{
+  CALL("BinaryClauses::Writer::writeSymbol");
+
+  OperatorType* type = function ? sym->fnType() : sym->predType();
+
+  if (function && sym->integerConstant()) {
+    writeUnsigned(SK_INTEGER);
+    writeUnsigned(0);
+    writeString(sym->integerValue().toString());
+    return;
+  }
+  if (function && (sym->rationalConstant() || sym->realConstant())) {
+    RationalConstantType val = sym->rationalConstant() ? sym->rationalValue() : sym->realValue();
+    writeUnsigned(sym->rationalConstant() ? SK_RATIONAL : SK_REAL);
+    writeUnsigned(0);
+    writeString(val.numerator().toString());
+    writeString(val.denominator().toString());
+    return;
+  }
+  if (sym->interpreted() && static_cast<Signature::InterpretedSymbol*>(sym)->getInterpretation() < Theory::numberOfFixedInterpretations()) {
+    writeUnsigned(SK_INTERPRETED);
+    writeUnsigned(0);
+    writeUnsigned(static_cast<Signature::InterpretedSymbol*>(sym)->getInterpretation());
+  }
+  else {
+    writeUnsigned(SK_PLAIN);
+    writeUnsigned(sym->skolem() ? 1 : 0);
+  }
+  writeString(sym->name());
+  writeType(type, function);
+} // BinaryClauses::Writer::writeSymbol
+
+class BinaryClauses::Reader
+{
+public:
+  Reader(istream& in) : _in(in) {}
+
+  UnitList* read(bool& haveConjecture);
+private:
+  unsigned readUnsigned();
+  vstring readString();
+  TermList readTerm(bool sort);
+  OperatorType* readType(bool function);
+  void readSymbol(bool function);
+  unsigned checkIndex(unsigned idx, const Stack<unsigned>& table);
+
+  istream& _in;
+
+  /** global numbers of the symbols, indexed by their local numbers */
+  Stack<unsigned> _typeCons;
+  Stack<unsigned> _functions;
+  Stack<unsigned> _predicates;
+};
+
+UnitList* BinaryClauses::read(istream& in, bool& haveConjecture)
+{
+  CALL("BinaryClauses::read");
+
+  return Reader(in).read(haveConjecture);
+}
+
+UnitList* BinaryClauses::Reader::read(bool& haveConjecture)
+{
+  CALL("BinaryClauses::Reader::read");
+
+  char magic[4];
+  if (!_in.read(magic, 4) || vstring(magic, 4) != MAGIC) {
+    USER_ERROR("Not a binary clause file");
+  }
+  if (readUnsigned() != VERSION) {
+    USER_ERROR("Unsupported version of the binary clause format");
+  }
+  bool numbers = readUnsigned() & FLAG_NUMBERS;
+
+  unsigned typeConCnt = readUnsigned();
+  for (unsigned i = 0; i < typeConCnt; i++) {
+    vstring name = readString();
+    unsigned arity = readUnsigned();
+    bool added;
+    unsigned tc = env.signature->addTypeCon(name, arity, added);
+    if (added) {
+      env.signature->getTypeCon(tc)->setType(OperatorType::getTypeConType(arity));
+    }
+    _typeCons.push(tc);
+  }
+  unsigned functionCnt = readUnsigned();
+  for (unsigned i = 0; i < functionCnt; i++) {
+    readSymbol(true);
+  }
+  _predicates.push(0);
+  unsigned predicateCnt = readUnsigned();
+  for (unsigned i = 0; i < predicateCnt; i++) {
+    readSymbol(false);
+  }
+
+  haveConjecture = false;
+  UnitList* res = 0;
+  UnitList** tail = &res;
+  static Stack<Literal*> lits;
+  static Stack<TermList> args;
+  unsigned clauseCnt = readUnsigned();
+  for (unsigned i = 0; i < clauseCnt; i++) {
+    unsigned inputType = readUnsigned();
+    if (inputType > toNumber(UnitInputType::MODEL_DEFINITION)) {
+      USER_ERROR("Invalid input type in binary clause file");
+    }
+    unsigned number = numbers ? readUnsigned() : 0;
+    unsigned length = readUnsigned();
+    lits.reset();
+    for (unsigned j = 0; j < length; j++) {
+      unsigned header = readUnsigned();
+      bool polarity = header & 1;
+      unsigned pred = checkIndex(header >> 1, _predicates);
+      unsigned arity = pred ? env.signature->predicateArity(pred) : 2;
+      args.reset();
+      for (unsigned k = 0; k < arity; k++) {
+        args.push(readTerm(false));
+      }
+      if (pred) {
+        lits.push(Literal::create(pred, arity, polarity, false, args.begin()));
+      }
+      else {
+        TermList sort = readTerm(true);
+        lits.push(Literal::createEquality(polarity, args[0], args[1], sort));
+      }
+    }
+    UnitInputType it = static_cast<UnitInputType>(inputType);
+    Clause* cl = Clause::fromStack(lits, NonspecificInference0(it, InferenceRule::INPUT));
+    if (numbers) {
+      vstring name = Int::toString(number);
+      Parse::TPTP::assignAxiomName(cl, name);
+    }
+    haveConjecture |= it == UnitInputType::CONJECTURE || it == UnitInputType::NEGATED_CONJECTURE;
+
+    *tail = new UnitList(cl);
+    tail = (*tail)->tailPtr();
+  }
+  return res;
+} // BinaryClauses::Reader::read
+
+unsigned BinaryClauses::Reader::readUnsigned()
+{
+  unsigned res = 0;
+  for (unsigned shift = 0; shift < 32; shift += 7) {
+    int c = _in.get();
+    if (c == EOF) {
+      USER_ERROR("Unexpected end of binary clause file");
+    }
+    res |= static_cast<unsigned>(c & 0x7f) << shift;
+    if (!(c & 0x80)) {
+      return res;
+    }
+  }
+  USER_ERROR("Invalid number in binary clause file");
+}
+
+vstring BinaryClauses::Reader::readString()
+{
+  unsigned len = readUnsigned();
+  vstring res(len, ' ');
+  if (len && !_in.read(&res[0], len)) {
+    USER_ERROR("Unexpected end of binary clause file");
+  }
+  return res;
+}
+
+unsigned BinaryClauses::Reader::checkIndex(unsigned idx, const Stack<unsigned>& table)
+{
+  if (idx >= table.size()) {
+    USER_ERROR("Invalid symbol reference in binary clause file");
+  }
+  return table[idx];
+}
+
+/**
+ * Read a term (or sort, if @c sort is true) written in prefix order.
+ */
+TermList BinaryClauses::Reader::readTerm(bool sort)
+{
+  CALL("BinaryClauses::Reader::readTerm");
+
+  // the symbols whose arguments are being read, the number of their missing
+  // arguments, and the arguments read so far
+  static Stack<unsigned> symbols;
+  static Stack<unsigned> missing;
+  static Stack<TermList> args;
+  ASS(symbols.isEmpty());
+  ASS(args.isEmpty());
+
+  for (;;) {
+    unsigned code = readUnsigned();
+    if (code & 1) {
+      if (sort) {
+        USER_ERROR("Sort variable in binary clause file");
+      }
+      args.push(TermList(code >> 1, false));
+    }
+    else {
+      unsigned sym = checkIndex(code >> 1, sort ? _typeCons : _functions);
+      unsigned arity = sort ? env.signature->typeConArity(sym) : env.signature->functionArity(sym);
+      if (arity) {
+        symbols.push(sym);
+        missing.push(arity);
+        continue;
+      }
+      args.push(sort ? TermList(AtomicSort::createConstant(sym)) : TermList(Term::createConstant(sym)));
+    }
+
+    // a term is complete, build the applications it completes
+    for (;;) {
+      if (symbols.isEmpty()) {
+        ASS_EQ(args.size(), 1);
+        return args.pop();
+      }
+      if (--missing.top()) {
+        break;
+      }
+      missing.pop();
+      unsigned sym = symbols.pop();
+      unsigned arity = sort ? env.signature->typeConArity(sym) : env.signature->functionArity(sym);
+      TermList* first = args.end() - arity;
+      TermList t(sort ? static_cast<Term*>(AtomicSort::create(sym, arity, first)) : Term::create(sym, arity, first));
+      args.truncate(args.size() - arity);
+      args.push(t);
+    }
+  }
+} // BinaryClauses::Reader::readTerm
+
+OperatorType* BinaryClauses::Reader::readType(bool function)
+{
+  CALL("BinaryClauses::Reader::readType");
+
+  static Stack<TermList> sorts;
+  sorts.reset();
+  unsigned arity = readUnsigned();
+  for (unsigned i = 0; i < arity; i++) {
+    sorts.push(readTerm(true));
+  }
+  if (function) {
+    TermList result = readTerm(true);
+    return OperatorType::getFunctionType(arity, sorts.begin(), result);
+  }
+  return OperatorType::getPredicateType(arity, sorts.begin());
+}
+
+void BinaryClauses::Reader::readSymbol(bool function)
+{
+  CALL("BinaryClauses::Reader::readSymbol");
+
+  Stack<unsigned>& table = function ? _functions : _predicates;
+  unsigned kind = readUnsigned();
+  bool skolem = readUnsigned() & 1;
+
+  switch (kind) {
+  case SK_INTEGER:
+  case SK_RATIONAL:
+  case SK_REAL:
+  {
+    if (!function) {
+      break;
+    }
+    vstring num = readString();
+    if (kind == SK_INTEGER) {
+      table.push(env.signature->addIntegerConstant(IntegerConstantType(num)));
+      return;
+    }
+    RationalConstantType val(num, readString());
+    table.push(kind == SK_RATIONAL ? env.signature->addRationalConstant(val)
+                                   : env.signature->addRealConstant(RealConstantType(val)));
+    return;
+  }
+  case SK_INTERPRETED:
+  {
+    unsigned itp = readUnsigned();
+    if (itp >= Theory::numberOfFixedInterpretations()) {
+      break;
+    }
+    vstring name = readString();
+    OperatorType* type = readType(function);
+    Interpretation interp = static_cast<Interpretation>(itp);
+    table.push(function ? env.signature->addInterpretedFunction(interp, type, name)
+                        : env.signature->addInterpretedPredicate(interp, type, name));
+    return;
+  }
+  case SK_PLAIN:
+  {
+    vstring name = readString();
+    OperatorType* type = readType(function);
+    unsigned arity = type->arity();
+    bool added;
+    unsigned sym = function ? env.signature->addFunction(name, arity, added)
+                            : env.signature->addPredicate(name, arity, added);
+    Signature::Symbol* symbol = function ? env.signature->getFunction(sym) : env.signature->getPredicate(sym);
+    if (added) {
+      symbol->setType(type);
+      if (skolem) {
+        symbol->markSkolem();
+      }
+    }
+    else if ((function ? symbol->fnType() : symbol->predType()) != type) {
+      USER_ERROR("Symbol " + name + " has a different type in the binary clause file");
+    }
+    table.push(sym);
+    return;
+  }
+  }
+  USER_ERROR("Invalid symbol in binary clause file");
+} // BinaryClauses::Reader::readSymbol
+
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file BinaryClauses.hpp
+ * Defines class BinaryClauses.
+ */
+
+#ifndef __BinaryClauses__
+#define __BinaryClauses__
+
+#include <iosfwd>
+
+#include "Forwards.hpp"
+
+#include "Lib/Stack.hpp"
+
+namespace Parse {
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * A compact binary format for sets of clauses, so that a problem clausified
+ * (or preprocessed) once can be handed to other Vampire runs without printing
+ * and parsing it again.
+ *
+ * All numbers are unsigned LEB128 varints, strings are a varint length
+ * followed by the characters. A file consists of
+ *
+ *   - the magic "VBCS" and the format version,
+ *   - flags (bit 0: clause numbers are included),
+ *   - the used type constructors: name, arity,
+ *   - the used function symbols: kind, skolem flag and, depending on the kind,
+ *     name, arity and type (plain symbols), the interpretation, name and type
+ *     (interpreted symbols), or the value (numerals),
+ *   - the used predicate symbols (except equality), as function symbols,
+ *   - the clauses: input type, number (if included), length and literals.
+ *
+ * Symbols are referred to by their position in the file's table.
+ * Sorts and terms are written in prefix order, a symbol as 2*index,
+ * a variable as 2*var+1. A literal is 2*predicate+polarity followed by its
+ * arguments, with predicate 0 being equality, which is followed by its sort.
+ *
+ * Only monomorphic first-order clauses are supported. Interpretations are
+ * stored by their number, so files are only meant to be read by the same
+ * version of Vampire.
+ */
+class BinaryClauses
+{
+public:
+  static void write(ostream& out, const Stack<Clause*>& clauses, bool numbers);
+  static UnitList* read(istream& in, bool& haveConjecture);
+private:
+  class Writer;
+  class Reader;
+};
+
+}
+
+#endif // __BinaryClauses__
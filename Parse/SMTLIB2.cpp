@@ -69,8 +69,9 @@ void SMTLIB2::parse(istream& str)
 
   LispLexer lex(str);
   LispParser lpar(lex);
-  LExpr* expr = lpar.parse();
-  parse(expr);
+  // the commands are read and translated one at a time,
+  // so that the expression of the whole benchmark is never built
+  readBenchmark([&lpar]() { return lpar.parseNext(); }, true);
 }
 
 void SMTLIB2::parse(LExpr* bench)
@@ -78,19 +79,38 @@ void SMTLIB2::parse(LExpr* bench)
   CALL("SMTLIB2::parse(LExpr*)");
 
   ASS(bench->isList());
-  readBenchmark(bench->list);
+  LExprList* commands = bench->list;
+  readBenchmark([&commands]() {
+    if (!commands) {
+      return static_cast<LExpr*>(0);
+    }
+    LExpr* res = commands->head();
+    commands = commands->tail();
+    return res;
+  }, false);
 }
 
-void SMTLIB2::readBenchmark(LExprList* bench)
+template<class CommandSource>
+void SMTLIB2::readBenchmark(CommandSource nextCommand, bool destroyCommands)
 {
   CALL("SMTLIB2::readBenchmark");
-  LispListReader bRdr(bench);
+
+  LExpr* lexp = 0;
+  // set for commands parts of which are still referred to after they have been read
+  bool keepCommand = false;
+  auto readNextCommand = [&]() {
+    if (destroyCommands && lexp && !keepCommand) {
+      lexp->destroy();
+    }
+    keepCommand = false;
+    lexp = nextCommand();
+    return lexp != 0;
+  };
 
   bool afterCheckSat = false;
 
   // iteration over benchmark top level entries
-  while(bRdr.hasNext()) {
-    LExpr* lexp = bRdr.next();
+  while(readNextCommand()) {
 
     LOG2("readBenchmark ",lexp->toString(true));
 
@@ -150,6 +170,8 @@ void SMTLIB2::readBenchmark(LExprList* bench)
       LExpr* body = ibRdr.readNext();
 
       readDefineSort(name,args,body);
+      // the definition is only parsed when used
+      keepCommand = true;
 
       ibRdr.acceptEOL();
 
@@ -311,7 +333,9 @@ void SMTLIB2::readBenchmark(LExprList* bench)
     }
 
     if (ibRdr.tryAcceptAtom("exit")) {
-      bRdr.acceptEOL();
+      if (readNextCommand()) {
+        USER_ERROR("exit should be the last entry");
+      }
       break;
     }
 
@@ -342,12 +366,14 @@ void SMTLIB2::readBenchmark(LExprList* bench)
   // however, we want to learn about an unsat core printing request
   // (or other things we might support in the future)
   if (afterCheckSat) {
-    while(bRdr.hasNext()) {
-      LispListReader ibRdr(bRdr.next());
+    while(readNextCommand()) {
+      LispListReader ibRdr(lexp);
       
       if (ibRdr.tryAcceptAtom("exit")) {
         ibRdr.acceptEOL(); // no arguments of exit
-        bRdr.acceptEOL();  // exit should be the last thing in the file
+        if (readNextCommand()) { // exit should be the last thing in the file
+          USER_ERROR("exit should be the last entry");
+        }
         break;
       }
       
@@ -367,6 +393,10 @@ void SMTLIB2::readBenchmark(LExprList* bench)
       break;
     }
   }
+
+  if (destroyCommands && lexp && !keepCommand) {
+    lexp->destroy();
+  }
 }
 
 //  ----------------------------------------------------------------------
@@ -484,9 +484,12 @@ private:
   Set<vstring> _overflow;
 
   /**
-   * Toplevel parsing dispatch for a benchmark.
+   * Toplevel parsing dispatch for a benchmark whose commands are
+   * supplied one by one by @b nextCommand, which returns 0 after the last one.
+   * If @b destroyCommands is true, each command is destroyed once it has been read.
    */
-  void readBenchmark(LExprList* bench);
+  template<class CommandSource>
+  void readBenchmark(CommandSource nextCommand, bool destroyCommands);
 };
 
 }
@@ -17,6 +17,7 @@
 #ifndef __Parser_TPTP__
 #define __Parser_TPTP__
 
+#include <cstring>
 #include <iostream>
 
 #include "Lib/Array.hpp"
@@ -665,15 +666,26 @@ private:
 
   /**
    * Get the next characters at the position pos.
+   *
+   * Characters are taken directly from the stream buffer of the input,
+   * which reads the file in blocks. Going through istream::get() would
+   * construct a sentry object and check the stream state for every
+   * character. No characters are read ahead, since on include() the
+   * rest of the current stream must stay in the stream.
    */
   inline char getChar(int pos)
   {
     CALL("TPTP::getChar");
 
-    while (_cend <= pos) {
-      int c = _in->get();
-      //      if (c == -1) { cout << "<EOF>"; } else {cout << char(c);}
-      _chars[_cend++] = c == -1 ? 0 : c;
+    if (_cend <= pos) {
+      std::streambuf* buf = _in->rdbuf();
+      _chars.get(pos); // expands the buffer to fit pos
+      char* chars = _chars.begin();
+      while (_cend <= pos) {
+        int c = buf->sbumpc();
+        //      if (c == EOF) { cout << "<EOF>"; } else {cout << char(c);}
+        chars[_cend++] = c == EOF ? 0 : c;
+      }
     }
     return _chars[pos];
   } // getChar
@@ -687,9 +699,7 @@ private:
     ASS(n > 0);
     ASS(n <= _cend);
 
-    for (int i = 0;i < _cend-n;i++) {
-      _chars[i] = _chars[n+i];
-    }
+    memmove(_chars.begin(), _chars.begin()+n, _cend-n);
     _cend -= n;
     _gpos += n;
   } // shiftChars
@@ -17,6 +17,9 @@
 #include "Lib/ScopedLet.hpp"
 
 #include "Lib/DArray.hpp"
+#include "Lib/Environment.hpp"
+
+#include "Shell/Statistics.hpp"
 
 namespace SAT
 {
@@ -94,7 +97,9 @@ void MinisatInterfacing::solveModuloAssumptionsAndSetStatus(unsigned conflictCou
   // TODO: consider calling simplify(); or only from time to time?
     
   _solver.setConfBudget(conflictCountLimit); // treating UINT_MAX as \infty
+  uint64_t conflictsBefore = _solver.conflicts;
   lbool res = _solver.solveLimited(_assumptions);
+  env.statistics->satConflicts += _solver.conflicts - conflictsBefore;
   
   if (res == l_True) {
     _status = SATISFIABLE;
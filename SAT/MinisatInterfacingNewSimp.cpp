@@ -127,7 +127,9 @@ void MinisatInterfacingNewSimp::solveModuloAssumptionsAndSetStatus(unsigned conf
     //cout << "Before: vars " << bef << ", non-unit clauses " << _solver.nClauses() << endl;
 
     _solver.setConfBudget(conflictCountLimit); // treating UINT_MAX as \infty
+    uint64_t conflictsBefore = _solver.conflicts;
     lbool res = _solver.solveLimited(_assumptions,true,true);
+    env.statistics->satConflicts += _solver.conflicts - conflictsBefore;
 
     //cout << "After: vars " << bef - _solver.eliminated_vars << ", non-unit clauses " << _solver.nClauses() << endl;
   
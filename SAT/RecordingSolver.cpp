@@ -0,0 +1,202 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file RecordingSolver.cpp
+ * Implements class RecordingSolver.
+ */
+
+#include <fstream>
+
+#include "Lib/Exception.hpp"
+
+#include "SAT/SATClause.hpp"
+
+#include "RecordingSolver.hpp"
+
+namespace SAT
+{
+
+RecordingSolver::RecordingSolver(SATSolver* inner, const vstring& traceFile)
+ : _inner(inner), _innerWithAssumptions(0)
+{
+  CALL("RecordingSolver::RecordingSolver");
+
+  BYPASSING_ALLOCATOR;
+  _out = new std::ofstream(traceFile.c_str());
+  if (_out->fail()) {
+    USER_ERROR("Cannot open SAT trace file: "+traceFile);
+  }
+  *_out << "p vtrace 1\n";
+}
+
+RecordingSolver::RecordingSolver(SATSolverWithAssumptions* inner, const vstring& traceFile)
+ : RecordingSolver(static_cast<SATSolver*>(inner), traceFile)
+{
+  _innerWithAssumptions = inner;
+}
+
+RecordingSolver::~RecordingSolver()
+{
+  CALL("RecordingSolver::~RecordingSolver");
+
+  BYPASSING_ALLOCATOR;
+  delete _out;
+}
+
+/**
+ * Return the name of the trace file for solver used by @b component
+ * when traces are requested with file name prefix @b prefix.
+ */
+vstring RecordingSolver::traceFileName(const vstring& prefix, const char* component)
+{
+  return prefix + "." + component;
+}
+
+void RecordingSolver::writeLiteral(SATLiteral lit)
+{
+  if (lit.isNegative()) {
+    *_out << '-';
+  }
+  *_out << lit.var();
+}
+
+void RecordingSolver::writeClause(char cmd, SATClause* cl)
+{
+  *_out << cmd;
+  for (unsigned i = 0; i < cl->length(); i++) {
+    *_out << ' ';
+    writeLiteral((*cl)[i]);
+  }
+  *_out << " 0\n";
+}
+
+/**
+ * Record the status returned by a solver call. The trace is flushed
+ * before and after each solving call, so that it is complete up to the
+ * last call even if the run is terminated without destroying the solver.
+ */
+SATSolver::Status RecordingSolver::recordStatus(Status st)
+{
+  *_out << "= " << (unsigned)st << '\n';
+  _out->flush();
+  return st;
+}
+
+void RecordingSolver::randomizeForNextAssignment(unsigned maxVar)
+{
+  CALL("RecordingSolver::randomizeForNextAssignment");
+
+  *_out << "R " << maxVar << '\n';
+  _inner->randomizeForNextAssignment(maxVar);
+}
+
+void RecordingSolver::addClause(SATClause* cl)
+{
+  CALL("RecordingSolver::addClause");
+
+  writeClause('c', cl);
+  _inner->addClause(cl);
+}
+
+void RecordingSolver::addClauseIgnoredInPartialModel(SATClause* cl)
+{
+  CALL("RecordingSolver::addClauseIgnoredInPartialModel");
+
+  writeClause('i', cl);
+  _inner->addClauseIgnoredInPartialModel(cl);
+}
+
+void RecordingSolver::simplify()
+{
+  CALL("RecordingSolver::simplify");
+
+  *_out << "S\n";
+  _inner->simplify();
+}
+
+SATSolver::Status RecordingSolver::solve(unsigned conflictCountLimit)
+{
+  CALL("RecordingSolver::solve");
+
+  *_out << "s " << conflictCountLimit << '\n';
+  _out->flush();
+  return recordStatus(_inner->solve(conflictCountLimit));
+}
+
+void RecordingSolver::ensureVarCount(unsigned newVarCnt)
+{
+  CALL("RecordingSolver::ensureVarCount");
+
+  *_out << "e " << newVarCnt << '\n';
+  _inner->ensureVarCount(newVarCnt);
+}
+
+unsigned RecordingSolver::newVar()
+{
+  CALL("RecordingSolver::newVar");
+
+  *_out << "v\n";
+  return _inner->newVar();
+}
+
+void RecordingSolver::suggestPolarity(unsigned var, unsigned pol)
+{
+  CALL("RecordingSolver::suggestPolarity");
+
+  *_out << "o " << var << ' ' << pol << '\n';
+  _inner->suggestPolarity(var,pol);
+}
+
+void RecordingSolver::addAssumption(SATLiteral lit)
+{
+  CALL("RecordingSolver::addAssumption");
+  ASS(_innerWithAssumptions);
+
+  *_out << "a ";
+  writeLiteral(lit);
+  *_out << '\n';
+  _innerWithAssumptions->addAssumption(lit);
+}
+
+void RecordingSolver::retractAllAssumptions()
+{
+  CALL("RecordingSolver::retractAllAssumptions");
+  ASS(_innerWithAssumptions);
+
+  *_out << "r\n";
+  _innerWithAssumptions->retractAllAssumptions();
+}
+
+SATSolver::Status RecordingSolver::solveUnderAssumptions(const SATLiteralStack& assumps, unsigned conflictCountLimit, bool onlyProperSubusets)
+{
+  CALL("RecordingSolver::solveUnderAssumptions");
+  ASS(_innerWithAssumptions);
+
+  *_out << "u " << conflictCountLimit << ' ' << (onlyProperSubusets ? 1 : 0);
+  for (unsigned i = 0; i < assumps.size(); i++) {
+    *_out << ' ';
+    writeLiteral(assumps[i]);
+  }
+  *_out << " 0\n";
+  _out->flush();
+  return recordStatus(_innerWithAssumptions->solveUnderAssumptions(assumps,conflictCountLimit,onlyProperSubusets));
+}
+
+const SATLiteralStack& RecordingSolver::explicitlyMinimizedFailedAssumptions(unsigned conflictCountLimit, bool randomize)
+{
+  CALL("RecordingSolver::explicitlyMinimizedFailedAssumptions");
+  ASS(_innerWithAssumptions);
+
+  *_out << "m " << conflictCountLimit << ' ' << (randomize ? 1 : 0) << '\n';
+  _out->flush();
+  return _innerWithAssumptions->explicitlyMinimizedFailedAssumptions(conflictCountLimit,randomize);
+}
+
+}
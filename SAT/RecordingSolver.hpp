@@ -0,0 +1,109 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file RecordingSolver.hpp
+ * Defines class RecordingSolver.
+ *
+ * A transparent wrapper which streams all the calls that change the state
+ * of the wrapped solver into a trace file. The trace can be re-run against
+ * any backend with SATTraceReplayer (see the vsat_replay binary), so the SAT
+ * layer can be benchmarked in isolation from the rest of the prover.
+ *
+ * The trace is a line based extension of DIMACS, literals are written as
+ * signed variable numbers and lists of literals are terminated by 0:
+ *
+ *   p vtrace 1              header
+ *   v                       newVar()
+ *   e n                     ensureVarCount(n)
+ *   c l1 ... lk 0           addClause
+ *   i l1 ... lk 0           addClauseIgnoredInPartialModel
+ *   o var pol               suggestPolarity(var,pol)
+ *   R maxVar                randomizeForNextAssignment(maxVar)
+ *   S                       simplify()
+ *   a l                     addAssumption(l)
+ *   r                       retractAllAssumptions()
+ *   s limit                 solve(limit)
+ *   u limit proper l1 .. 0  solveUnderAssumptions(lits,limit,proper)
+ *   m limit randomize       explicitlyMinimizedFailedAssumptions(limit,randomize)
+ *   = status                status returned by the preceding solve call (0 sat, 1 unsat, 2 unknown)
+ */
+
+#ifndef __RecordingSolver__
+#define __RecordingSolver__
+
+#include <iosfwd>
+
+#include "Forwards.hpp"
+
+#include "Lib/ScopedPtr.hpp"
+
+#include "SATSolver.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+class RecordingSolver : public SATSolverWithAssumptions {
+public:
+  CLASS_NAME(RecordingSolver);
+  USE_ALLOCATOR(RecordingSolver);
+
+  RecordingSolver(SATSolver* inner, const vstring& traceFile);
+  RecordingSolver(SATSolverWithAssumptions* inner, const vstring& traceFile);
+  virtual ~RecordingSolver();
+
+  virtual SATClause* getRefutation() override { return _inner->getRefutation(); }
+  virtual SATClauseList* getRefutationPremiseList() override { return _inner->getRefutationPremiseList(); }
+  virtual void randomizeForNextAssignment(unsigned maxVar) override;
+
+  virtual void addClause(SATClause* cl) override;
+  virtual void addClauseIgnoredInPartialModel(SATClause* cl) override;
+  virtual void simplify() override;
+  virtual Status solve(unsigned conflictCountLimit) override;
+  virtual VarAssignment getAssignment(unsigned var) override { return _inner->getAssignment(var); }
+
+  virtual bool isZeroImplied(unsigned var) override { return _inner->isZeroImplied(var); }
+  virtual void collectZeroImplied(SATLiteralStack& acc) override { _inner->collectZeroImplied(acc); }
+  virtual SATClause* getZeroImpliedCertificate(unsigned var) override { return _inner->getZeroImpliedCertificate(var); }
+
+  virtual void ensureVarCount(unsigned newVarCnt) override;
+  virtual unsigned newVar() override;
+  virtual void suggestPolarity(unsigned var,unsigned pol) override;
+
+  virtual void addAssumption(SATLiteral lit) override;
+  virtual void retractAllAssumptions() override;
+  virtual bool hasAssumptions() const override {
+    ASS(_innerWithAssumptions);
+    return _innerWithAssumptions->hasAssumptions();
+  }
+
+  virtual Status solveUnderAssumptions(const SATLiteralStack& assumps, unsigned conflictCountLimit, bool onlyProperSubusets) override;
+  virtual const SATLiteralStack& failedAssumptions() override {
+    ASS(_innerWithAssumptions);
+    return _innerWithAssumptions->failedAssumptions();
+  }
+  virtual const SATLiteralStack& explicitlyMinimizedFailedAssumptions(unsigned conflictCountLimit, bool randomize) override;
+
+  static vstring traceFileName(const vstring& prefix, const char* component);
+
+private:
+  void writeLiteral(SATLiteral lit);
+  void writeClause(char cmd, SATClause* cl);
+  Status recordStatus(Status st);
+
+  ScopedPtr<SATSolver> _inner;
+  /** The same object as _inner if it supports assumptions, otherwise zero */
+  SATSolverWithAssumptions* _innerWithAssumptions;
+  std::ostream* _out;
+};
+
+}
+
+#endif // __RecordingSolver__
@@ -37,17 +37,17 @@ namespace SAT {
 using namespace Lib;
 using namespace Shell;
 
+SATClauseArena::Ref SATClause::s_allocatedRef = 0;
+
 /**
- * Allocate a clause having lits literals.
+ * Return the number of bytes occupied by a clause with @b length literals.
  */
-void* SATClause::operator new(size_t sz,unsigned lits)
+size_t SATClause::sizeInBytes(unsigned length)
 {
-  CALL("SATClause::operator new");
-
   //We have to get sizeof(SATClause) + (_length-1)*sizeof(SATLiteral*)
   //this way, because _length-1 wouldn't behave well for
   //_length==0 on x64 platform.
-  size_t size=sz+lits*sizeof(SATLiteral);
+  size_t size=sizeof(SATClause)+length*sizeof(SATLiteral);
   /*
     it's not safe to save memory for the empty clause,
     since the compiler wants to call a constructor 
@@ -55,14 +55,30 @@ void* SATClause::operator new(size_t sz,unsigned lits)
   
     SATLiteral _literals[1];
   */
-  if (lits > 0)
+  if (length > 0)
     size-=sizeof(SATLiteral);
+  return size;
+}
+
+/**
+ * Allocate a clause having lits literals.
+ */
+void* SATClause::operator new(size_t sz,unsigned lits)
+{
+  CALL("SATClause::operator new");
+  ASS_EQ(sz,sizeof(SATClause));
+
+  size_t size=sizeInBytes(lits);
+  SATClauseArena* arena=SATClauseArena::instance();
+  void* mem=arena->allocate(size,s_allocatedRef);
 
-  return ALLOC_KNOWN(size,"SATClause");
+  env.statistics->satClauseBytes+=size;
+  env.statistics->satClauseArenaPeak=arena->peakReservedBytes();
+  return mem;
 }
 
 SATClause::SATClause(unsigned length)
-  : _length(length), _nonDestroyable(0), _inference(0)
+  : _length(length), _nonDestroyable(0), _ref(s_allocatedRef), _inference(0)
 {
   env.statistics->satClauses++;
   if(length==1) {
@@ -94,12 +110,8 @@ void SATClause::destroy()
     delete _inference;
   }
   
-  //We have to get sizeof(SATClause) + (_length-1)*sizeof(SATLiteral*)
-  //this way, because _length-1 wouldn't behave well for
-  //_length==0 on x64 platform.
-  size_t size=sizeof(SATClause)+_length*sizeof(SATLiteral);
-  if (_length > 0) // see comment in operator new(size_t sz,unsigned lits) above
-    size-=sizeof(SATLiteral);
+  size_t size=sizeInBytes(_length);
+  SATClauseArena::Ref ref=_ref;
 
   // call a destructor on the excess literals
   for (size_t i = 1; i < _length; i++)
@@ -108,7 +120,7 @@ void SATClause::destroy()
   // call a destructor of the clause object (will destroy _literals[0])
   this->~SATClause();
     
-  DEALLOC_KNOWN(this, size,"SATClause");
+  SATClauseArena::instance()->release(ref,size);
 } // SATClause::destroy
 
 
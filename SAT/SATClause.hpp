@@ -25,6 +25,7 @@
 #include "Lib/VString.hpp"
 
 #include "SATLiteral.hpp"
+#include "SATClauseArena.hpp"
 
 namespace SAT {
 
@@ -34,6 +35,9 @@ using namespace Kernel;
 
 /**
  * Class to represent clauses.
+ *
+ * Clauses are stored in the SATClauseArena and can be identified
+ * by a 32-bit reference, see ref() and fromRef().
  * @since 10/05/2007 Manchester
  */
 class SATClause
@@ -53,6 +57,12 @@ public:
 
   void* operator new(size_t,unsigned length);
 
+  /** Return the 32-bit reference of the clause */
+  inline SATClauseArena::Ref ref() const { return _ref; }
+  /** Return the clause with reference @b ref */
+  static SATClause* fromRef(SATClauseArena::Ref ref)
+  { return static_cast<SATClause*>(SATClauseArena::instance()->deref(ref)); }
+
   /**
    * Return the (reference to) the nth literal
    */
@@ -84,9 +94,19 @@ public:
   static SATClause* fromStack(SATLiteralStack& stack);
 
 private:
+  static size_t sizeInBytes(unsigned length);
+
+  /**
+   * Reference of the clause most recently allocated by operator new,
+   * to be picked up by the constructor
+   */
+  static SATClauseArena::Ref s_allocatedRef;
+
   /** number of literals */
   unsigned _length : 31;
   unsigned _nonDestroyable : 1;
+  /** reference of the clause in the SATClauseArena (fits in the padding before _inference) */
+  SATClauseArena::Ref _ref;
 
   SATInference* _inference;
 
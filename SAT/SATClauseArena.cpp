@@ -0,0 +1,178 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATClauseArena.cpp
+ * Implements class SATClauseArena.
+ */
+
+#include <climits>
+
+#include "Debug/Assertion.hpp"
+#include "Debug/Tracer.hpp"
+
+#include "SATClauseArena.hpp"
+
+namespace SAT {
+
+SATClauseArena::SATClauseArena()
+ : _current(0), _liveBytes(0), _reservedBytes(0), _peakReservedBytes(0)
+{
+  CALL("SATClauseArena::SATClauseArena");
+
+  newCurrentBlock();
+}
+
+/**
+ * Return the arena in which all SATClause objects live.
+ *
+ * The arena is never destroyed, the clauses may be referenced
+ * from proofs until the very end of the run.
+ */
+SATClauseArena* SATClauseArena::instance()
+{
+  static SATClauseArena* inst = new SATClauseArena();
+  return inst;
+}
+
+/**
+ * Allocate @b size bytes, assign to @b ref the reference of the allocated
+ * piece and return its address.
+ */
+void* SATClauseArena::allocate(size_t size, Ref& ref)
+{
+  CALL("SATClauseArena::allocate");
+
+  unsigned units = (size + UNIT - 1) / UNIT;
+  _liveBytes += size;
+
+  if (units > BLOCK_UNITS) {
+    // a block of its own
+    unsigned idx = acquireBlockIndex();
+    Block& b = _blocks[idx];
+    b.mem = static_cast<char*>(ALLOC_KNOWN(units * UNIT, "SATClauseArena::Block"));
+    b.capacity = units;
+    b.top = units;
+    b.live = 1;
+    reserve(units * UNIT);
+    ref = idx * BLOCK_UNITS;
+    return b.mem;
+  }
+
+  if (_blocks[_current].top + units > _blocks[_current].capacity) {
+    newCurrentBlock();
+  }
+  Block& b = _blocks[_current];
+  ASS_LE(b.top + units, b.capacity);
+
+  ref = _current * BLOCK_UNITS + b.top;
+  void* res = b.mem + b.top * UNIT;
+  b.top += units;
+  b.live++;
+  return res;
+}
+
+/**
+ * Release piece of memory @b ref of @b size bytes. If it was the last live
+ * piece of its block, the block is recycled.
+ */
+void SATClauseArena::release(Ref ref, size_t size)
+{
+  CALL("SATClauseArena::release");
+
+  unsigned idx = ref / BLOCK_UNITS;
+  Block& b = _blocks[idx];
+  ASS_G(b.live, 0);
+  ASS_GE(_liveBytes, size);
+
+  _liveBytes -= size;
+  if (--b.live == 0) {
+    reclaimBlock(idx);
+  }
+}
+
+unsigned SATClauseArena::acquireBlockIndex()
+{
+  CALL("SATClauseArena::acquireBlockIndex");
+
+  if (_freeSlots.isNonEmpty()) {
+    return _freeSlots.pop();
+  }
+  // references must fit into 32 bits
+  ASS_L(_blocks.size(), UINT_MAX / BLOCK_UNITS);
+  Block b;
+  b.mem = 0;
+  b.capacity = 0;
+  b.top = 0;
+  b.live = 0;
+  _blocks.push(b);
+  return _blocks.size() - 1;
+}
+
+/**
+ * Make an empty standard block the current one.
+ */
+void SATClauseArena::newCurrentBlock()
+{
+  CALL("SATClauseArena::newCurrentBlock");
+
+  if (_spareBlocks.isNonEmpty()) {
+    _current = _spareBlocks.pop();
+    ASS(_blocks[_current].mem);
+    return;
+  }
+  _current = acquireBlockIndex();
+  Block& b = _blocks[_current];
+  b.mem = static_cast<char*>(ALLOC_KNOWN(BLOCK_UNITS * UNIT, "SATClauseArena::Block"));
+  b.capacity = BLOCK_UNITS;
+  b.top = 0;
+  b.live = 0;
+  reserve(BLOCK_UNITS * UNIT);
+}
+
+/**
+ * Recycle block @b idx which no longer contains live pieces.
+ */
+void SATClauseArena::reclaimBlock(unsigned idx)
+{
+  CALL("SATClauseArena::reclaimBlock");
+
+  Block& b = _blocks[idx];
+  ASS_EQ(b.live, 0);
+
+  b.top = 0;
+  if (idx == _current) {
+    return;
+  }
+  if (b.capacity == BLOCK_UNITS && _spareBlocks.size() < MAX_SPARE_BLOCKS) {
+    _spareBlocks.push(idx);
+    return;
+  }
+  DEALLOC_KNOWN(b.mem, b.capacity * UNIT, "SATClauseArena::Block");
+  unreserve(b.capacity * UNIT);
+  b.mem = 0;
+  b.capacity = 0;
+  _freeSlots.push(idx);
+}
+
+void SATClauseArena::reserve(size_t bytes)
+{
+  _reservedBytes += bytes;
+  if (_reservedBytes > _peakReservedBytes) {
+    _peakReservedBytes = _reservedBytes;
+  }
+}
+
+void SATClauseArena::unreserve(size_t bytes)
+{
+  ASS_GE(_reservedBytes, bytes);
+  _reservedBytes -= bytes;
+}
+
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATClauseArena.hpp
+ * Defines class SATClauseArena.
+ */
+
+#ifndef __SATClauseArena__
+#define __SATClauseArena__
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Stack.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+/**
+ * Block-based storage for SATClause objects.
+ *
+ * Clauses (header and literals) are bump-allocated into fixed-size blocks and
+ * are identified by 32-bit references (block index and offset within the block).
+ * Each block counts its live clauses and once the last of them is destroyed
+ * the whole block is recycled. This suits the way AVATAR and FMB produce SAT
+ * clauses: many short clauses which are either kept for the whole run or
+ * dropped in bulk once the solver has consumed them.
+ *
+ * Clauses larger than a block get a block of their own.
+ */
+class SATClauseArena
+{
+public:
+  CLASS_NAME(SATClauseArena);
+  USE_ALLOCATOR(SATClauseArena);
+
+  /** 32-bit reference to a piece of memory in the arena */
+  typedef unsigned Ref;
+
+  static SATClauseArena* instance();
+
+  void* allocate(size_t size, Ref& ref);
+  void release(Ref ref, size_t size);
+
+  /** Return the memory referenced by @b ref */
+  void* deref(Ref ref) const
+  {
+    const Block& b = _blocks[ref / BLOCK_UNITS];
+    ASS(b.mem);
+    return b.mem + (ref % BLOCK_UNITS) * UNIT;
+  }
+
+  /** Number of bytes occupied by live clauses */
+  size_t liveBytes() const { return _liveBytes; }
+  /** Number of bytes currently obtained from the allocator */
+  size_t reservedBytes() const { return _reservedBytes; }
+  /** Maximal value reservedBytes() ever reached */
+  size_t peakReservedBytes() const { return _peakReservedBytes; }
+
+private:
+  SATClauseArena();
+
+  /** Granularity (and alignment) of allocation, must suffice for SATClause */
+  static const size_t UNIT = 8;
+  /** Size of a standard block in units (i.e. 64KB) */
+  static const unsigned BLOCK_UNITS = 8192;
+  /** Maximal number of empty standard blocks kept around for reuse */
+  static const unsigned MAX_SPARE_BLOCKS = 4;
+
+  struct Block {
+    /** Memory of the block, zero if the slot is currently unused */
+    char* mem;
+    /** Capacity of the block in units */
+    unsigned capacity;
+    /** First unused unit */
+    unsigned top;
+    /** Number of live pieces allocated in the block */
+    unsigned live;
+  };
+
+  unsigned acquireBlockIndex();
+  void newCurrentBlock();
+  void reclaimBlock(unsigned idx);
+  void reserve(size_t bytes);
+  void unreserve(size_t bytes);
+
+  Stack<Block> _blocks;
+  /** Indices of empty standard blocks which still own their memory */
+  Stack<unsigned> _spareBlocks;
+  /** Indices of block slots without memory */
+  Stack<unsigned> _freeSlots;
+  /** Index of the block into which we currently allocate */
+  unsigned _current;
+
+  size_t _liveBytes;
+  size_t _reservedBytes;
+  size_t _peakReservedBytes;
+}; // class SATClauseArena
+
+}
+
+#endif /* __SATClauseArena__ */
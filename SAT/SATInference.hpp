@@ -141,7 +141,8 @@ template <typename Filter>
 void SATInference::collectFilteredFOPremises(SATClause* cl, Stack<Unit*>& acc, Filter f)
 {
   CALL("SATInference::collectFilteredFOPremises");
-  ASS_ALLOC_TYPE(cl, "SATClause");
+  // SAT clauses live in the SATClauseArena, so check the clause is where its reference points
+  ASS_EQ(SATClause::fromRef(cl->ref()), cl);
 
   static Stack<SATClause*> toDo;
   static DHSet<SATClause*> seen;
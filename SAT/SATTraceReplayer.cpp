@@ -0,0 +1,190 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATTraceReplayer.cpp
+ * Implements class SATTraceReplayer.
+ */
+
+#include <istream>
+#include <ostream>
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/Timer.hpp"
+
+#include "SAT/SATClause.hpp"
+
+#include "SATTraceReplayer.hpp"
+
+namespace SAT
+{
+
+using namespace std;
+
+SATLiteral SATTraceReplayer::readLiteral(istream& in)
+{
+  int lit;
+  if (!(in >> lit) || lit == 0) {
+    USER_ERROR("SAT trace: literal expected");
+  }
+  return lit > 0 ? SATLiteral(lit,1) : SATLiteral(-lit,0);
+}
+
+/**
+ * Read a 0-terminated list of literals into @b acc.
+ */
+void SATTraceReplayer::readLiterals(istream& in, SATLiteralStack& acc)
+{
+  CALL("SATTraceReplayer::readLiterals");
+
+  acc.reset();
+  int lit;
+  while (in >> lit) {
+    if (lit == 0) {
+      return;
+    }
+    acc.push(lit > 0 ? SATLiteral(lit,1) : SATLiteral(-lit,0));
+  }
+  USER_ERROR("SAT trace: unterminated list of literals");
+}
+
+SATSolverWithAssumptions& SATTraceReplayer::withAssumptions()
+{
+  if (!_withAssumptions) {
+    USER_ERROR("SAT trace uses assumptions, but the chosen solver does not support them");
+  }
+  return *_withAssumptions;
+}
+
+SATTraceReplayer::~SATTraceReplayer()
+{
+  CALL("SATTraceReplayer::~SATTraceReplayer");
+
+  while (_addedClauses.isNonEmpty()) {
+    _addedClauses.pop()->destroy();
+  }
+}
+
+/**
+ * Perform the calls recorded in the trace @b in.
+ */
+void SATTraceReplayer::replay(istream& in)
+{
+  CALL("SATTraceReplayer::replay");
+
+  vstring header;
+  unsigned version;
+  if (!(in >> header) || header != "p" || !(in >> header) || header != "vtrace" || !(in >> version) || version != 1) {
+    USER_ERROR("Not a SAT trace (version 1)");
+  }
+
+  static SATLiteralStack lits;
+  SATSolver::Status lastStatus = SATSolver::UNKNOWN;
+
+  char cmd;
+  while (in >> cmd) {
+    unsigned n, m;
+    switch (cmd) {
+      case 'v':
+        _solver->newVar();
+        break;
+      case 'e':
+        in >> n;
+        _solver->ensureVarCount(n);
+        break;
+      case 'c':
+      case 'i': {
+        readLiterals(in,lits);
+        SATClause* cl = SATClause::fromStack(lits);
+        _addedClauses.push(cl);
+        _clauses++;
+        int start = env.timer->elapsedMilliseconds();
+        if (cmd == 'c') {
+          _solver->addClause(cl);
+        } else {
+          _solver->addClauseIgnoredInPartialModel(cl);
+        }
+        _addTime += env.timer->elapsedMilliseconds() - start;
+        break;
+      }
+      case 'o':
+        in >> n >> m;
+        _solver->suggestPolarity(n,m);
+        break;
+      case 'R':
+        in >> n;
+        _solver->randomizeForNextAssignment(n);
+        break;
+      case 'S':
+        _solver->simplify();
+        break;
+      case 'a':
+        withAssumptions().addAssumption(readLiteral(in));
+        break;
+      case 'r':
+        withAssumptions().retractAllAssumptions();
+        break;
+      case 's':
+      case 'u': {
+        in >> n;
+        if (cmd == 'u') {
+          in >> m;
+          readLiterals(in,lits);
+        }
+        _solveCalls++;
+        int start = env.timer->elapsedMilliseconds();
+        if (cmd == 's') {
+          lastStatus = _solver->solve(n);
+        } else {
+          lastStatus = withAssumptions().solveUnderAssumptions(lits,n,m);
+        }
+        _solveTime += env.timer->elapsedMilliseconds() - start;
+        break;
+      }
+      case 'm': {
+        in >> n >> m;
+        int start = env.timer->elapsedMilliseconds();
+        withAssumptions().explicitlyMinimizedFailedAssumptions(n,m);
+        _solveTime += env.timer->elapsedMilliseconds() - start;
+        break;
+      }
+      case '=':
+        in >> n;
+        // a different UNKNOWN is fine, the backends need not agree on conflict budgets
+        if (n != (unsigned)lastStatus && n != SATSolver::UNKNOWN && lastStatus != SATSolver::UNKNOWN) {
+          _statusMismatches++;
+        }
+        break;
+      default:
+        USER_ERROR("SAT trace: unknown command "+vstring(1,cmd));
+    }
+    if (in.fail()) {
+      USER_ERROR("SAT trace: malformed arguments of command "+vstring(1,cmd));
+    }
+  }
+}
+
+void SATTraceReplayer::printStatistics(ostream& out)
+{
+  CALL("SATTraceReplayer::printStatistics");
+
+  out << "Clauses added: " << _clauses << endl;
+  out << "Solve calls: " << _solveCalls << endl;
+  out << "Status mismatches: " << _statusMismatches << endl;
+  out << "Time adding clauses: ";
+  Timer::printMSString(out,_addTime);
+  out << endl;
+  out << "Time solving: ";
+  Timer::printMSString(out,_solveTime);
+  out << endl;
+}
+
+}
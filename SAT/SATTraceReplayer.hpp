@@ -0,0 +1,79 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATTraceReplayer.hpp
+ * Defines class SATTraceReplayer.
+ */
+
+#ifndef __SATTraceReplayer__
+#define __SATTraceReplayer__
+
+#include <iosfwd>
+
+#include "Forwards.hpp"
+
+#include "Lib/Stack.hpp"
+
+#include "SATSolver.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+/**
+ * Re-runs a trace written by RecordingSolver against a solver,
+ * measuring the time spent in the individual kinds of calls.
+ */
+class SATTraceReplayer
+{
+public:
+  /**
+   * Replay into @b solver. If the trace contains assumptions,
+   * @b withAssumptions must be the same solver object.
+   */
+  SATTraceReplayer(SATSolver* solver, SATSolverWithAssumptions* withAssumptions)
+   : _solver(solver), _withAssumptions(withAssumptions),
+     _clauses(0), _solveCalls(0), _statusMismatches(0), _addTime(0), _solveTime(0) {}
+  ~SATTraceReplayer();
+
+  void replay(std::istream& in);
+  void printStatistics(std::ostream& out);
+
+  /** Number of replayed solve calls */
+  unsigned solveCalls() const { return _solveCalls; }
+  /** Number of solve calls which returned a different status than in the trace */
+  unsigned statusMismatches() const { return _statusMismatches; }
+
+private:
+  SATLiteral readLiteral(std::istream& in);
+  void readLiterals(std::istream& in, SATLiteralStack& acc);
+  SATSolverWithAssumptions& withAssumptions();
+
+  SATSolver* _solver;
+  SATSolverWithAssumptions* _withAssumptions;
+
+  /**
+   * the solver is not supposed to own the clauses, so we keep them here
+   * and destroy them together with the replayer
+   */
+  Stack<SATClause*> _addedClauses;
+
+  unsigned _clauses;
+  unsigned _solveCalls;
+  unsigned _statusMismatches;
+  /** time spent adding clauses (in ms) */
+  int _addTime;
+  /** time spent in solving (in ms) */
+  int _solveTime;
+};
+
+}
+
+#endif // __SATTraceReplayer__
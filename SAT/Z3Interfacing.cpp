@@ -874,15 +874,24 @@ struct ToZ3Expr
     if(trm->numTermArguments()==0) {
       if(symb->integerConstant()){
         IntegerConstantType value = symb->integerValue();
-        return self._context.int_val(value.toInner());
+        if (value.isSmall()) {
+          return self._context.int_val(value.toInner());
+        }
+        return self._context.int_val(value.toString().c_str());
       }
       if(symb->realConstant()) {
         RealConstantType value = symb->realValue();
-        return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
+        if (value.numerator().isSmall() && value.denominator().isSmall()) {
+          return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
+        }
+        return self._context.real_val(value.toString().c_str());
       }
       if(symb->rationalConstant()) {
         RationalConstantType value = symb->rationalValue();
-        return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
+        if (value.numerator().isSmall() && value.denominator().isSmall()) {
+          return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
+        }
+        return self._context.real_val(value.toString().c_str());
       }
       if(!isLit && env.signature->isFoolConstantSymbol(true,trm->functor())) {
         return self._context.bool_val(true);
@@ -63,6 +63,7 @@
 #include "Inferences/Factoring.hpp"
 #include "Inferences/ForwardDemodulation.hpp"
 #include "Inferences/ForwardLiteralRewriting.hpp"
+#include "Inferences/IntegerBoundSubsumption.hpp"
 #include "Inferences/ForwardSubsumptionAndResolution.hpp"
 #include "Inferences/ForwardSubsumptionDemodulation.hpp"
 #include "Inferences/GlobalSubsumption.hpp"
@@ -1692,6 +1693,9 @@ SaturationAlgorithm* SaturationAlgorithm::createFromOptions(Problem& prb, const
   if (opt.forwardLiteralRewriting()) {
     res->addForwardSimplifierToFront(new ForwardLiteralRewriting());
   }
+  if (opt.integerBoundSubsumption()) {
+    res->addForwardSimplifierToFront(new IntegerBoundSubsumption());
+  }
   if (prb.hasEquality()) {
     // NOTE:
     // fsd should be performed after forward subsumption,
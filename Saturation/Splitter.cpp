@@ -42,6 +42,7 @@
 #include "SAT/MinimizingSolver.hpp"
 #include "SAT/BufferedSolver.hpp"
 #include "SAT/FallbackSolverWrapper.hpp"
+#include "SAT/RecordingSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
@@ -103,12 +104,21 @@ void SplittingBranchSelector::init()
     default:
       ASSERTION_VIOLATION_REP(_parent.getOptions().splittingMinimizeModel());
   }
+
+  if (!_parent.getOptions().recordSatTrace().empty()) {
+    _solver = new RecordingSolver(_solver.release(),
+        RecordingSolver::traceFileName(_parent.getOptions().recordSatTrace(),"avatar"));
+  }
   _minSCO = _parent.getOptions().splittingMinimizeModel() == Options::SplittingMinimizeModel::SCO;
 
   if(_parent.getOptions().splittingCongruenceClosure() != Options::SplittingCongruenceClosure::OFF) {
-    _dp = new DP::SimpleCongruenceClosure(&_parent.getOrdering());
     if (_parent.getOptions().ccUnsatCores() == Options::CCUnsatCores::SMALL_ONES) {
+      _dp = new DP::SimpleCongruenceClosure(&_parent.getOrdering());
       _dp = new ShortConflictMetaDP(_dp.release(), _parent.satNaming(), *_solver);
+    } else if (_parent.getOptions().ccIncremental()) {
+      _ccIncremental = new DP::SimpleCongruenceClosure(&_parent.getOrdering());
+    } else {
+      _dp = new DP::SimpleCongruenceClosure(&_parent.getOrdering());
     }
     _ccMultipleCores = (_parent.getOptions().ccUnsatCores() != Options::CCUnsatCores::FIRST);
 
@@ -117,6 +127,10 @@ void SplittingBranchSelector::init()
       _dpModel = new DP::SimpleCongruenceClosure(&_parent.getOrdering());
     }
   }  
+
+  if(_parent.getOptions().splittingArithmetic()) {
+    _arithDp = new DP::Simplex();
+  }
 }
 
 void SplittingBranchSelector::updateVarCnt()
@@ -388,18 +402,83 @@ int SplittingBranchSelector::assertedGroundPositiveEqualityCompomentMaxAge()
   return max;
 }
 
+/**
+ * Bring the incremental congruence closure in line with the ground
+ * assignment @c gndAssignment. Each asserted literal has its own
+ * backtracking level, so we only retract literals from the first one
+ * that is no longer true and then add the literals that are missing.
+ */
+void SplittingBranchSelector::updateIncrementalCC(const LiteralStack& gndAssignment)
+{
+  CALL("SplittingBranchSelector::updateIncrementalCC");
+
+  static DHSet<Literal*> current;
+  current.reset();
+  current.loadFromIterator(LiteralStack::ConstIterator(gndAssignment));
+
+  unsigned keep = 0;
+  while (keep < _ccAsserted.size() && current.contains(_ccAsserted[keep])) {
+    keep++;
+  }
+  while (_ccAsserted.size() > keep) {
+    _ccAssertedSet.remove(_ccAsserted.pop());
+    _ccIncremental->pop();
+  }
+
+  LiteralStack::ConstIterator it(gndAssignment);
+  while (it.hasNext()) {
+    Literal* lit = it.next();
+    if (!lit->ground() || !_ccAssertedSet.insert(lit)) {
+      continue;
+    }
+    _ccAsserted.push(lit);
+    _ccIncremental->push();
+    _ccIncremental->addLiteral(lit);
+  }
+  ASS_EQ(_ccAsserted.size(), _ccIncremental->level());
+}
+
+/**
+ * Add the unsat cores of @c dp as conflict clauses to the SAT solver
+ * and return their number.
+ */
+unsigned SplittingBranchSelector::addDPConflicts(DecisionProcedure& dp)
+{
+  CALL("SplittingBranchSelector::addDPConflicts");
+
+  DecisionProcedure::Status dpStatus = dp.getStatus(_ccMultipleCores);
+  if(dpStatus!=DecisionProcedure::UNSATISFIABLE) {
+    return 0;
+  }
+
+  SAT2FO& s2f = _parent.satNaming();
+  static LiteralStack unsatCore;
+
+  unsigned unsatCoreCnt = dp.getUnsatCoreCount();
+  for(unsigned i=0; i<unsatCoreCnt; i++) {
+    unsatCore.reset();
+    dp.getUnsatCore(unsatCore, i);
+    SATClause* conflCl = s2f.createConflictClause(unsatCore);
+    if (_minSCO) {
+      _solver->addClauseIgnoredInPartialModel(conflCl);
+    } else {
+      _solver->addClause(conflCl);
+    }
+  }
+  return unsatCoreCnt;
+}
+
 SATSolver::Status SplittingBranchSelector::processDPConflicts()
 {
   CALL("SplittingBranchSelector::processDPConflicts");
   // ASS(_solver->getStatus()==SATSolver::SATISFIABLE);
 
-  if(!_dp) {
+  if(!_dp && !_ccIncremental && !_arithDp) {
     return SATSolver::SATISFIABLE;
   }
   
   SAT2FO& s2f = _parent.satNaming();
   static LiteralStack gndAssignment;
-  static LiteralStack unsatCore;
 
   while (true) { // breaks inside
     {
@@ -410,24 +489,23 @@ SATSolver::Status SplittingBranchSelector::processDPConflicts()
       s2f.collectAssignment(*_solver, gndAssignment); 
       // ... moreover, _dp->addLiterals will filter the set anyway
 
-      _dp->reset();
-      _dp->addLiterals(pvi( LiteralStack::ConstIterator(gndAssignment) ));
-      DecisionProcedure::Status dpStatus = _dp->getStatus(_ccMultipleCores);
-
-      if(dpStatus!=DecisionProcedure::UNSATISFIABLE) {
-        break;
+      unsigned unsatCoreCnt = 0;
+      if (_ccIncremental) {
+        updateIncrementalCC(gndAssignment);
+        unsatCoreCnt += addDPConflicts(*_ccIncremental);
       }
-
-      unsigned unsatCoreCnt = _dp->getUnsatCoreCount();
-      for(unsigned i=0; i<unsatCoreCnt; i++) {
-        unsatCore.reset();
-        _dp->getUnsatCore(unsatCore, i);
-        SATClause* conflCl = s2f.createConflictClause(unsatCore);
-        if (_minSCO) {
-          _solver->addClauseIgnoredInPartialModel(conflCl);
-        } else {
-          _solver->addClause(conflCl);
+      DecisionProcedure* dps[] = { _dp.ptr(), _arithDp.ptr() };
+      for (DecisionProcedure* dp : dps) {
+        if (!dp) {
+          continue;
         }
+        dp->reset();
+        dp->addLiterals(pvi( LiteralStack::ConstIterator(gndAssignment) ));
+        unsatCoreCnt += addDPConflicts(*dp);
+      }
+
+      if(!unsatCoreCnt) {
+        break;
       }
 
       RSTAT_CTR_INC("ssat_dp_conflict");
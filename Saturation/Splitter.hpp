@@ -20,6 +20,7 @@
 #include "Lib/Allocator.hpp"
 #include "Lib/ArrayMap.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/ScopedPtr.hpp"
 
@@ -35,6 +36,7 @@
 
 #include "DP/DecisionProcedure.hpp"
 #include "DP/SimpleCongruenceClosure.hpp"
+#include "DP/Simplex.hpp"
 
 #include "Lib/Allocator.hpp"
 
@@ -56,7 +58,7 @@ class Splitter;
  */
 class SplittingBranchSelector {
 public:
-  SplittingBranchSelector(Splitter& parent) : _ccModel(false), _parent(parent), _solverIsSMT(false)  {}
+  SplittingBranchSelector(Splitter& parent) : _ccMultipleCores(false), _ccModel(false), _parent(parent), _solverIsSMT(false)  {}
   ~SplittingBranchSelector(){
 #if VZ3
 {
@@ -81,6 +83,8 @@ private:
   friend class Splitter;
 
   SATSolver::Status processDPConflicts();
+  void updateIncrementalCC(const LiteralStack& gndAssignment);
+  unsigned addDPConflicts(DecisionProcedure& dp);
   SATSolver::VarAssignment getSolverAssimentConsideringCCModel(unsigned var);
 
   void handleSatRefutation();
@@ -103,6 +107,13 @@ private:
   ScopedPtr<DecisionProcedure> _dp;
   // use a separate copy of the decision procedure for ccModel computations and fill it up only with equalities
   ScopedPtr<SimpleCongruenceClosure> _dpModel;
+  // congruence closure kept between the calls to processDPConflicts (used instead of _dp)
+  ScopedPtr<SimpleCongruenceClosure> _ccIncremental;
+  // the literals asserted in _ccIncremental, one per backtracking level
+  LiteralStack _ccAsserted;
+  DHSet<Literal*> _ccAssertedSet;
+  // ground linear arithmetic decision procedure, checked next to _dp
+  ScopedPtr<DecisionProcedure> _arithDp;
   
   /**
    * Contains selected component names (splitlevels)
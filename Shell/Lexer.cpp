@@ -64,7 +64,8 @@ bool Lexer::readNextChar ()
     return false;
   }
 
-  _lastCharacter = _stream.get();
+  // read from the stream buffer directly, istream::get() constructs a sentry for every character
+  _lastCharacter = _stream.rdbuf()->sbumpc();
   if (_lastCharacter == -1) {
     _eof = true;
     return false;
@@ -218,7 +219,7 @@ int Lexer::lookAhead()
   CALL("Lexer::lookAhead");
   ASS(! _lookAheadChar); // cannot look ahead by two characters!
 
-  _lookAheadChar = _stream.get();
+  _lookAheadChar = _stream.rdbuf()->sbumpc();
   return _lookAheadChar;
 } // Lexer::lookAhead()
 
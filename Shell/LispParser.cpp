@@ -95,9 +95,29 @@ LispParser::Expression* LispParser::parse()
 //} // parse()
 
 /**
+ * Parse the next top-level expression and return it,
+ * or return 0 if there is none left.
+ */
+LispParser::Expression* LispParser::parseNext()
+{
+  CALL("LispParser::parseNext");
+
+  List* exprs = 0;
+  parse(&exprs, true);
+  if (!exprs) {
+    return 0;
+  }
+  Expression* result = List::pop(exprs);
+  ASS(!exprs);
+  return result;
+} // parseNext()
+
+/**
+ * Parse expressions into the list @c expr0 until the end of the input
+ * or, if @c onlyOne is true, until a complete top-level expression is read.
  * @since 26/08/2009 Redmond
  */
-void LispParser::parse(List** expr0)
+void LispParser::parse(List** expr0, bool onlyOne)
 {
   CALL("LispParser::parse/1");
 
@@ -140,6 +160,9 @@ void LispParser::parse(List** expr0)
         List* sub = new List(subexpr);
         *expr = sub;
         expr = sub->tailPtr();
+        if (onlyOne && stack.size() == 1) {
+          return;
+        }
         break;
       }
       case TT_EOF:
@@ -155,6 +178,9 @@ void LispParser::parse(List** expr0)
   parsing_level_done:
     ASS(stack.isNonEmpty());
     expr = stack.pop();
+    if (onlyOne && stack.size() == 1) {
+      return;
+    }
   }
 
 } // parse()
@@ -191,6 +217,26 @@ vstring LispParser::Expression::toString(bool outerParentheses) const
   ASSERTION_VIOLATION;
 } // LispParser::Expression::toString
 
+/**
+ * Destroy this expression together with all its subexpressions.
+ */
+void LispParser::Expression::destroy()
+{
+  CALL("LispParser::Expression::destroy");
+
+  static Stack<Expression*> todo;
+  ASS(todo.isEmpty());
+
+  todo.push(this);
+  while (todo.isNonEmpty()) {
+    Expression* e = todo.pop();
+    while (e->list) {
+      todo.push(List::pop(e->list));
+    }
+    delete e;
+  }
+} // LispParser::Expression::destroy
+
 /**
  * If expression corresponds to a unary function named @c funcionName,
  * return true and assign its argument to @c arg. Otherwise return false.
@@ -72,6 +72,7 @@ public:
 	list(0)
     {}
     vstring toString(bool outerParentheses=true) const;
+    void destroy();
 
     bool isList() const { return tag==LIST; }
     bool isAtom() const { return tag==ATOM; }
@@ -86,7 +87,8 @@ public:
 
   explicit LispParser(LispLexer& lexer);
   Expression* parse();
-  void parse(List**);
+  Expression* parseNext();
+  void parse(List**, bool onlyOne=false);
 
   /**
    * Class Exception. Implements parser exceptions.
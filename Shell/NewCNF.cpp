@@ -951,6 +951,14 @@ TermList NewCNF::inlineLetBinding(unsigned symbol, VList* bindingVariables, Term
   return Flattening::flatten(inlinedContents);
 }
 
+/**
+ * Return the free variables of @b g
+ *
+ * The sets are computed from those of the immediate subformulas, which get
+ * cached too. Otherwise each of the nested quantifiers being skolemised or
+ * subformulas being named would traverse the whole formula below it again,
+ * which is quadratic in the depth of the formula.
+ */
 VarSet* NewCNF::freeVars(Formula* g)
 {
   CALL("NewCNF::freeVars");
@@ -963,10 +971,90 @@ VarSet* NewCNF::freeVars(Formula* g)
     return res;
   }
 
-  res = (VarSet*)VarSet::getFromIterator(FormulaVarIterator(g));
+  static Stack<Formula*> todo;
+  ASS(todo.isEmpty());
+  todo.push(g);
+  while (todo.isNonEmpty()) {
+    Formula* f = todo.top();
+    if (_freeVars.find(f)) {
+      todo.pop();
+      continue;
+    }
 
-  _freeVars.insert(g,res);
-  return res;
+    // first make sure the subformulas are done
+    unsigned pending = todo.size();
+    switch (f->connective()) {
+      case AND:
+      case OR: {
+        FormulaList::Iterator args(f->args());
+        while (args.hasNext()) {
+          Formula* arg = args.next();
+          if (!_freeVars.find(arg)) {
+            todo.push(arg);
+          }
+        }
+        break;
+      }
+      case IMP:
+      case IFF:
+      case XOR:
+        if (!_freeVars.find(f->left())) {
+          todo.push(f->left());
+        }
+        if (!_freeVars.find(f->right())) {
+          todo.push(f->right());
+        }
+        break;
+      case NOT:
+        if (!_freeVars.find(f->uarg())) {
+          todo.push(f->uarg());
+        }
+        break;
+      case FORALL:
+      case EXISTS:
+        if (!_freeVars.find(f->qarg())) {
+          todo.push(f->qarg());
+        }
+        break;
+      default:
+        break;
+    }
+    if (todo.size() != pending) {
+      continue;
+    }
+    todo.pop();
+
+    switch (f->connective()) {
+      case AND:
+      case OR: {
+        res = VarSet::getEmpty();
+        FormulaList::Iterator args(f->args());
+        while (args.hasNext()) {
+          res = res->getUnion(_freeVars.get(args.next()));
+        }
+        break;
+      }
+      case IMP:
+      case IFF:
+      case XOR:
+        res = _freeVars.get(f->left())->getUnion(_freeVars.get(f->right()));
+        break;
+      case NOT:
+        res = _freeVars.get(f->uarg());
+        break;
+      case FORALL:
+      case EXISTS:
+        res = _freeVars.get(f->qarg())->subtract(VarSet::getFromIterator(VList::Iterator(f->vars())));
+        break;
+      default:
+        // atoms (possibly with FOOL subterms)
+        res = (VarSet*)VarSet::getFromIterator(FormulaVarIterator(f));
+        break;
+    }
+    _freeVars.insert(f,res);
+  }
+
+  return _freeVars.get(g);
 }
 
 void NewCNF::ensureHavingVarSorts()
@@ -114,6 +114,7 @@ void Options::init()
                                         "preprocess2",
                                         "profile",
                                         "random_strategy",
+                                        "server",
                                         "smtcomp",
                                         "spider",
                                         "tclausify",
@@ -127,6 +128,7 @@ void Options::init()
     "  -preprocess,axiom_selection,clausify: modes for producing output\n      for other solvers.\n"
     "  -tpreprocess,tclausify: output modes for theory input (clauses are quantified\n      with sort information).\n"
     "  -output,profile: output information about the problem\n"
+    "  -server: keep axiom libraries loaded and prove conjectures sent over a\n      Unix socket (see server_socket)\n"
     "Some modes are not currently maintained (get in touch if interested):\n"
     "  -bpa: perform bound propagation\n"
     "  -consequence_elimination: perform consequence elimination\n"
@@ -196,6 +198,12 @@ void Options::init()
     _lookup.insert(&_ltbDirectory);
     _ltbDirectory.setExperimental();
 
+    _serverSocket = StringOptionValue("server_socket","","");
+    _serverSocket.description = "Path of the Unix socket the server mode listens on.";
+    _lookup.insert(&_serverSocket);
+    _serverSocket.onlyUsefulWith(_mode.is(equal(Mode::SERVER)));
+    _serverSocket.setExperimental();
+
     _decode = DecodeOptionValue("decode","",this);
     _decode.description="Decodes an encoded strategy. Can be used to replay a strategy. To make Vampire output an encoded version of the strategy use the encode option.";
     _lookup.insert(&_decode);
@@ -377,9 +385,10 @@ void Options::init()
                                                  //in case we compile vampire with bpa, then the default input syntax is smtlib
                                                  InputSyntax::AUTO,
                                                  //{"simplify","smtlib","smtlib2","tptp"});//,"xhuman","xmps","xnetlib"});
-                                                 {"smtlib2","tptp","auto"});//,"xhuman","xmps","xnetlib"});
+                                                 {"smtlib2","tptp","auto","binary"});//,"xhuman","xmps","xnetlib"});
     _inputSyntax.description=
-    "Input syntax. Historic input syntaxes have been removed as they are not actively maintained. Contact developers for help with these.";
+    "Input syntax. Historic input syntaxes have been removed as they are not actively maintained. Contact developers for help with these."
+    " The binary syntax reads clauses written using binary_output.";
     _lookup.insert(&_inputSyntax);
     _inputSyntax.tag(OptionTag::INPUT);
 
@@ -700,6 +709,15 @@ void Options::init()
     _lookup.insert(&_showFOOL);
     _showFOOL.tag(OptionTag::OUTPUT);
 
+    _binaryOutput = ChoiceOptionValue<BinaryOutput>("binary_output","",BinaryOutput::OFF,{"off","on","numbered"});
+    _binaryOutput.description="Write the result of clausification or preprocessing in the binary clause format"
+                              " (which can be read using input_syntax binary) instead of TPTP."
+                              " If numbered, the clause numbers are kept and used as the names of the read clauses.";
+    _lookup.insert(&_binaryOutput);
+    _binaryOutput.tag(OptionTag::OUTPUT);
+    _binaryOutput.onlyUsefulWith(Or(Or(_mode.is(equal(Mode::CLAUSIFY)),_mode.is(equal(Mode::TCLAUSIFY))),
+                                    Or(_mode.is(equal(Mode::PREPROCESS)),_mode.is(equal(Mode::PREPROCESS2)))));
+
     _showFMBsortInfo = BoolOptionValue("show_fmb_sort_info","",false);
     _showFMBsortInfo.description = "Print information about sorts in FMB";
     _lookup.insert(&_showFMBsortInfo);
@@ -838,6 +856,12 @@ void Options::init()
     _fmbSymmetryWidgetOrders.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
     _fmbSymmetryWidgetOrders.tag(OptionTag::FMB);
 
+    _fmbSymmetryPredicates = UnsignedOptionValue("fmb_symmetry_predicates","fmbsp",0);
+    _fmbSymmetryPredicates.description = "Detect predicates that can be swapped without changing the problem and only look for models where their interpretations are lexicographically ordered. The value bounds the number of ground atoms compared for each pair of predicates, 0 means off.";
+    _lookup.insert(&_fmbSymmetryPredicates);
+    _fmbSymmetryPredicates.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbSymmetryPredicates.tag(OptionTag::FMB);
+
     _fmbAdjustSorts = ChoiceOptionValue<FMBAdjustSorts>("fmb_adjust_sorts","fmbas",
                                                            FMBAdjustSorts::GROUP,
                                                            {"off","expand","group","predicate","function"});
@@ -1665,6 +1689,14 @@ void Options::init()
     _forwardLiteralRewriting.onlyUsefulWith(InferencingSaturationAlgorithm());
     _forwardLiteralRewriting.setRandomChoices({"on","off"});
 
+    _integerBoundSubsumption = BoolOptionValue("integer_bound_subsumption","ibs",false);
+    _integerBoundSubsumption.description="Delete clauses containing a ground integer comparison that is implied by the bound given by a ground unit clause.";
+    _lookup.insert(&_integerBoundSubsumption);
+    _integerBoundSubsumption.tag(OptionTag::INFERENCES);
+    _integerBoundSubsumption.addProblemConstraint(hasTheories());
+    _integerBoundSubsumption.onlyUsefulWith(InferencingSaturationAlgorithm());
+    _integerBoundSubsumption.setRandomChoices({"on","off"});
+
     _forwardSubsumption = BoolOptionValue("forward_subsumption","fs",true);
     _forwardSubsumption.description="Perform forward subsumption deletion.";
     _lookup.insert(&_forwardSubsumption);
@@ -1925,8 +1957,8 @@ void Options::init()
     _globalSubsumption.setRandomChoices({"off","on"});
 
     _globalSubsumptionSatSolverPower = ChoiceOptionValue<GlobalSubsumptionSatSolverPower>("global_subsumption_sat_solver_power","gsssp",
-          GlobalSubsumptionSatSolverPower::PROPAGATION_ONLY,{"propagation_only","full"});
-    _globalSubsumptionSatSolverPower.description="";
+          GlobalSubsumptionSatSolverPower::PROPAGATION_ONLY,{"propagation_only","full","adaptive"});
+    _globalSubsumptionSatSolverPower.description="How much effort the SAT solver spends on each global subsumption check. With adaptive, the conflict budget of the calls grows while they keep succeeding and shrinks when they run out of it.";
     _lookup.insert(&_globalSubsumptionSatSolverPower);
     _globalSubsumptionSatSolverPower.tag(OptionTag::INFERENCES);
     _globalSubsumptionSatSolverPower.onlyUsefulWith(_globalSubsumption.is(equal(true)));
@@ -2074,6 +2106,24 @@ void Options::init()
     _ccUnsatCores.onlyUsefulWith(_splittingCongruenceClosure.is(notEqual(SplittingCongruenceClosure::OFF)));
     _ccUnsatCores.setRandomChoices({"first", "small_ones", "all"});
 
+    _ccIncremental = BoolOptionValue("cc_incremental","cci",false);
+    _ccIncremental.description="Keep the congruence closure between AVATAR model checks and only add and retract the literals that changed their value.";
+    _lookup.insert(&_ccIncremental);
+    _ccIncremental.tag(OptionTag::AVATAR);
+    _ccIncremental.onlyUsefulWith(_splittingCongruenceClosure.is(notEqual(SplittingCongruenceClosure::OFF)));
+    _ccIncremental.onlyUsefulWith(_ccUnsatCores.is(notEqual(CCUnsatCores::SMALL_ONES)));
+    _ccIncremental.setRandomChoices({"on","off"});
+
+    _splittingArithmetic = BoolOptionValue("avatar_arithmetic","aar",false);
+    _splittingArithmetic.description="Use a simplex-based decision procedure for ground linear arithmetic on top of the AVATAR SAT solver. This ensures that models produced by AVATAR do not contain linear arithmetic conflicts.";
+    _lookup.insert(&_splittingArithmetic);
+    _splittingArithmetic.tag(OptionTag::AVATAR);
+    _splittingArithmetic.onlyUsefulWith(_splitting.is(equal(true)));
+#if VZ3
+    _splittingArithmetic.onlyUsefulWith(_satSolver.is(notEqual(SatSolver::Z3)));
+#endif
+    _splittingArithmetic.addProblemConstraint(hasTheories());
+
     _splittingLiteralPolarityAdvice = ChoiceOptionValue<SplittingLiteralPolarityAdvice>(
                                                 "avatar_literal_polarity_advice","alpa",
                                                 SplittingLiteralPolarityAdvice::NONE,
@@ -2212,6 +2262,12 @@ void Options::init()
 
 #endif
 
+    _recordSatTrace = StringOptionValue("record_sat_trace","","");
+    _recordSatTrace.description="Record the calls to the SAT solvers of AVATAR, finite model building and global subsumption"
+      " into trace files with this prefix (followed by .avatar, .fmb or .gs). The traces can be re-run with vsat_replay.";
+    _lookup.insert(&_recordSatTrace);
+    _recordSatTrace.tag(OptionTag::SAT);
+
     //*************************************************************
     //*********************** which mode or tag?  ************************
     //*************************************************************
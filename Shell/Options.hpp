@@ -363,13 +363,23 @@ public:
     SMTLIB2 = 0,
     /** syntax of the TPTP prover */
     TPTP = 1, 
-    AUTO = 2
+    AUTO = 2,
+    /** Vampire's binary clause format, see Parse::BinaryClauses */
+    BINARY = 3
     //HUMAN = 4,
     //MPS = 5, 
     //NETLIB = 6
   };
 
 
+  /** Whether clausify and preprocess modes write their result in the binary clause format */
+  enum class BinaryOutput : unsigned int {
+    OFF = 0,
+    ON = 1,
+    /** also write the clause numbers */
+    NUMBERED = 2
+  };
+
   /**
    * Possible values for mode_name.
    * @since 06/05/2007 Manchester
@@ -390,6 +400,7 @@ public:
     PREPROCESS2,
     PROFILE,
     RANDOM_STRATEGY,
+    SERVER,
     SMTCOMP,
     SPIDER,
     TCLAUSIFY,
@@ -639,7 +650,8 @@ public:
 
   enum class GlobalSubsumptionSatSolverPower : unsigned int {
     PROPAGATION_ONLY,
-    FULL
+    FULL,
+    ADAPTIVE
   };
 
   enum class GlobalSubsumptionExplicitMinim : unsigned int {
@@ -2084,6 +2096,7 @@ public:
   float fmbSymmetryRatio() const { return _fmbSymmetryRatio.actualValue; }
   FMBWidgetOrders fmbSymmetryWidgetOrders() { return _fmbSymmetryWidgetOrders.actualValue;}
   FMBSymbolOrders fmbSymmetryOrderSymbols() const {return _fmbSymmetryOrderSymbols.actualValue; }
+  unsigned fmbSymmetryPredicates() const { return _fmbSymmetryPredicates.actualValue; }
   FMBAdjustSorts fmbAdjustSorts() const {return _fmbAdjustSorts.actualValue; }
   bool fmbDetectSortBounds() const { return _fmbDetectSortBounds.actualValue; }
   unsigned fmbDetectSortBoundsTimeLimit() const { return _fmbDetectSortBoundsTimeLimit.actualValue; }
@@ -2094,6 +2107,7 @@ public:
   bool flattenTopLevelConjunctions() const { return _flattenTopLevelConjunctions.actualValue; }
   LTBLearning ltbLearning() const { return _ltbLearning.actualValue; }
   vstring ltbDirectory() const { return _ltbDirectory.actualValue; }
+  vstring serverSocket() const { return _serverSocket.actualValue; }
   Mode mode() const { return _mode.actualValue; }
   Schedule schedule() const { return _schedule.actualValue; }
   vstring scheduleName() const { return _schedule.getStringOfValue(_schedule.actualValue); }
@@ -2137,6 +2151,7 @@ public:
   bool showSymbolElimination() const { return showAll() || _showSymbolElimination.actualValue; }
   bool showTheoryAxioms() const { return showAll() || _showTheoryAxioms.actualValue; }
   bool showFOOL() const { return showAll() || _showFOOL.actualValue; }
+  BinaryOutput binaryOutput() const { return _binaryOutput.actualValue; }
   bool showFMBsortInfo() const { return showAll() || _showFMBsortInfo.actualValue; }
   bool showInduction() const { return showAll() || _showInduction.actualValue; }
   bool showSimplOrdering() const { return showAll() || _showSimplOrdering.actualValue; }
@@ -2177,6 +2192,7 @@ public:
   void setUnusedPredicateDefinitionRemoval(bool newVal) { _unusedPredicateDefinitionRemoval.actualValue = newVal; }
   // bool useDM() const { return _use_dm.actualValue; }
   SatSolver satSolver() const { return _satSolver.actualValue; }
+  vstring const& recordSatTrace() const { return _recordSatTrace.actualValue; }
   //void setSatSolver(SatSolver newVal) { _satSolver = newVal; }
   SaturationAlgorithm saturationAlgorithm() const { return _saturationAlgorithm.actualValue; }
   void setSaturationAlgorithm(SaturationAlgorithm newVal) { _saturationAlgorithm.actualValue = newVal; }
@@ -2210,6 +2226,7 @@ public:
   unsigned backwardSubsumptionDemodulationMaxMatches() const { return _backwardSubsumptionDemodulationMaxMatches.actualValue; }
   bool forwardSubsumption() const { return _forwardSubsumption.actualValue; }
   bool forwardLiteralRewriting() const { return _forwardLiteralRewriting.actualValue; }
+  bool integerBoundSubsumption() const { return _integerBoundSubsumption.actualValue; }
   int lrsFirstTimeCheck() const { return _lrsFirstTimeCheck.actualValue; }
   int lrsWeightLimitOnly() const { return _lrsWeightLimitOnly.actualValue; }
   int lookaheadDelay() const { return _lookaheadDelay.actualValue; }
@@ -2377,6 +2394,8 @@ public:
   bool splittingEagerRemoval() const { return _splittingEagerRemoval.actualValue; }
   SplittingCongruenceClosure splittingCongruenceClosure() const { return _splittingCongruenceClosure.actualValue; }
   CCUnsatCores ccUnsatCores() const { return _ccUnsatCores.actualValue; }
+  bool ccIncremental() const { return _ccIncremental.actualValue; }
+  bool splittingArithmetic() const { return _splittingArithmetic.actualValue; }
 
   void setProof(Proof p) { _proof.actualValue = p; }
     
@@ -2586,6 +2605,7 @@ private:
   FloatOptionValue _fmbSymmetryRatio;
   ChoiceOptionValue<FMBWidgetOrders> _fmbSymmetryWidgetOrders;
   ChoiceOptionValue<FMBSymbolOrders> _fmbSymmetryOrderSymbols;
+  UnsignedOptionValue _fmbSymmetryPredicates;
   ChoiceOptionValue<FMBAdjustSorts> _fmbAdjustSorts;
   BoolOptionValue _fmbDetectSortBounds;
   UnsignedOptionValue _fmbDetectSortBoundsTimeLimit;
@@ -2599,6 +2619,7 @@ private:
   StringOptionValue _forcedOptions;
   ChoiceOptionValue<Demodulation> _forwardDemodulation;
   BoolOptionValue _forwardLiteralRewriting;
+  BoolOptionValue _integerBoundSubsumption;
   BoolOptionValue _forwardSubsumption;
   BoolOptionValue _forwardSubsumptionResolution;
   BoolOptionValue _forwardSubsumptionDemodulation;
@@ -2673,6 +2694,7 @@ private:
   BoolOptionValue _lrsWeightLimitOnly;
   ChoiceOptionValue<LTBLearning> _ltbLearning;
   StringOptionValue _ltbDirectory;
+  StringOptionValue _serverSocket;
 
 #ifdef __linux__
   UnsignedOptionValue _instructionLimit; 
@@ -2712,6 +2734,7 @@ private:
   IntOptionValue _activationLimit;
 
   ChoiceOptionValue<SatSolver> _satSolver;
+  StringOptionValue _recordSatTrace;
   ChoiceOptionValue<SaturationAlgorithm> _saturationAlgorithm;
   BoolOptionValue _showAll;
   BoolOptionValue _showActive;
@@ -2737,6 +2760,7 @@ private:
   BoolOptionValue _showSymbolElimination;
   BoolOptionValue _showTheoryAxioms;
   BoolOptionValue _showFOOL;
+  ChoiceOptionValue<BinaryOutput> _binaryOutput;
   BoolOptionValue _showFMBsortInfo;
   BoolOptionValue _showInduction;
   BoolOptionValue _showSimplOrdering;
@@ -2768,6 +2792,8 @@ private:
   ChoiceOptionValue<SplittingAddComplementary> _splittingAddComplementary;
   ChoiceOptionValue<SplittingCongruenceClosure> _splittingCongruenceClosure;
   ChoiceOptionValue<CCUnsatCores> _ccUnsatCores;
+  BoolOptionValue _ccIncremental;
+  BoolOptionValue _splittingArithmetic;
   BoolOptionValue _splittingEagerRemoval;
   UnsignedOptionValue _splittingFlushPeriod;
   FloatOptionValue _splittingFlushQuotient;
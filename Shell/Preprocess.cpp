@@ -16,6 +16,7 @@
 
 #include "Debug/Tracer.hpp"
 
+#include "Lib/Allocator.hpp"
 #include "Lib/ScopedLet.hpp"
 
 #include "Kernel/Unit.hpp"
@@ -253,7 +254,12 @@ void Preprocess::preprocess(Problem& prb)
     pdRemover.removeUnusedDefinitionsAndPurePredicates(prb);
   }
 
-  if (prb.mayHaveFormulas()) {
+  // Unless we shuffle in between, ENNF is applied to each unit just before
+  // it is clausified, so that the problem is traversed only once
+  bool useNewCnf = _options.newCNF() && !prb.hasPolymorphicSym() && !prb.higherOrder();
+  bool ennfWithNewCnf = useNewCnf && !_options.shuffleInput();
+
+  if (prb.mayHaveFormulas() && !ennfWithNewCnf) {
     if (env.options->showPreprocessing())
       env.out() << "preprocess 2 (ennf,flatten)" << std::endl;
 
@@ -270,12 +276,11 @@ void Preprocess::preprocess(Problem& prb)
     Shuffling::shuffle(prb);
   }
 
-  if (prb.mayHaveFormulas() && _options.newCNF() && 
-     !prb.hasPolymorphicSym() && !prb.higherOrder()) {
+  if (prb.mayHaveFormulas() && useNewCnf) {
     if (env.options->showPreprocessing())
-      env.out() << "newCnf" << std::endl;
+      env.out() << (ennfWithNewCnf ? "ennf, flatten and newCnf" : "newCnf") << std::endl;
 
-    newCnf(prb);
+    newCnf(prb, ennfWithNewCnf);
   } else {
     if (prb.mayHaveFormulas() && _options.newCNF()) { // TODO: update newCNF to deal with polymorphism / higher-order
       ASS(prb.hasPolymorphicSym() || prb.higherOrder());
@@ -296,16 +301,11 @@ void Preprocess::preprocess(Problem& prb)
 
     if (prb.mayHaveFormulas()) {
       if (env.options->showPreprocessing())
-        env.out() << "preprocess3 (nnf, flatten, skolemize)" << std::endl;
-
-      preprocess3(prb);
-    }
-
-    if (prb.mayHaveFormulas()) {
-      if (env.options->showPreprocessing())
-        env.out() << "clausify" << std::endl;
+        env.out() << "preprocess3 (nnf, flatten, skolemize) and clausify" << std::endl;
 
-      clausify(prb);
+      // skolemisation is local to each unit and CNF introduces no symbols,
+      // so both are done in one traversal without changing the result
+      clausify(prb, true);
     }
   }
 
@@ -462,6 +462,9 @@ void Preprocess::preprocess(Problem& prb)
      UIHelper::outputAllPremises(cerr, prb.units());
    }
 
+   // the allocator never gives pages back, so this is also the peak during preprocessing
+   env.statistics->preprocessingMemory = Allocator::getUsedMemory();
+
    if (env.options->showPreprocessing()) {
      env.out() << "preprocessing finished" << std::endl;
      env.endOutput();
@@ -592,9 +595,11 @@ void Preprocess::naming(Problem& prb)
 }
 
 /**
- * Perform the NewCNF algorithm on problem @c prb which is in ENNF
+ * Perform the NewCNF algorithm on problem @c prb which is in ENNF.
+ * If @c ennf is true, the problem is not in ENNF yet and each formula
+ * is transformed to ENNF and flattened just before its clausification.
  */
-void Preprocess::newCnf(Problem& prb)
+void Preprocess::newCnf(Problem& prb, bool ennf)
 {
   CALL("Preprocess::newCnf");
 
@@ -626,6 +631,9 @@ void Preprocess::newCnf(Problem& prb)
     }
     modified = true;
     FormulaUnit* fu = static_cast<FormulaUnit*>(u);
+    if (ennf) {
+      fu = Flattening::flatten(NNF::ennf(fu));
+    }
     cnf.clausify(fu,clauses);
     while (! clauses.isEmpty()) {
       Clause* cl = clauses.pop();
@@ -715,7 +723,11 @@ void Preprocess::preprocess3 (Problem& prb)
   }
 } // Preprocess::preprocess3
 
-void Preprocess::clausify(Problem& prb)
+/**
+ * Clausify problem @c prb. If @c skolemise is true, each unit is first
+ * preprocessed by preprocess3(Unit*), otherwise it must be skolemised already.
+ */
+void Preprocess::clausify(Problem& prb, bool skolemise)
 {
   CALL("Preprocess::clausify");
 
@@ -744,6 +756,9 @@ void Preprocess::clausify(Problem& prb)
       continue;
     }
     modified = true;
+    if (skolemise) {
+      u = preprocess3(u, prb.higherOrder());
+    }
     cnf.clausify(u,clauses);
     while (! clauses.isEmpty()) {
       Unit* u = clauses.pop();
@@ -51,9 +51,9 @@ private:
   void naming(Problem& prb);
   Unit* preprocess3(Unit* u, bool appify /*higher order stuff*/);
   void preprocess3(Problem& prb);
-  void clausify(Problem& prb);
+  void clausify(Problem& prb, bool skolemise=false);
 
-  void newCnf(Problem& prb);
+  void newCnf(Problem& prb, bool ennf=false);
 
   /** Options used in the normalisation */
   const Options& _options;
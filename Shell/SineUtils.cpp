@@ -533,47 +533,76 @@ bool SineSelector::perform(UnitList*& units)
 }
 
 //////////////////////////////////////
-// SineTheorySelector
+// SineMultiSelector
 //////////////////////////////////////
 
-SineTheorySelector::SineTheorySelector(const Options& opt)
-: _genThreshold(opt.sineGeneralityThreshold()), _opt(opt)
+SineMultiSelector::SineMultiSelector(bool onIncluded, unsigned genThreshold)
+: _onIncluded(onIncluded), _genThreshold(genThreshold), _unitCount(0)
 {
-  CALL("SineTheorySelector::SineTheorySelector");
+  CALL("SineMultiSelector::SineMultiSelector");
 }
 
-void SineTheorySelector::handlePossibleSignatureChange()
+unsigned SineMultiSelector::addVariant(float tolerance, unsigned depthLimit)
 {
-  CALL("SineTheorySelector::handlePossibleSignatureChange");
+  CALL("SineMultiSelector::addVariant");
+  ASS(tolerance>=1.0f || tolerance==-1);
+  ASS(_selected.size()==0); // perform() has not been called yet
 
-  size_t symIdBound=_symExtr.getSymIdBound();
-  size_t oldSize=_def.size();
-  ASS_EQ(_gen.size(), oldSize);
+  unsigned idx;
+  if (findVariant(tolerance,depthLimit,idx)) {
+    return idx;
+  }
+  Variant v;
+  v.tolerance=tolerance;
+  v.depthLimit=depthLimit;
+  v.tolIdx=0;
+  _variants.push(v);
+
+  if (!_tolerances.find(tolerance)) {
+    _tolerances.push(tolerance);
+    std::sort(_tolerances.begin(),_tolerances.end(),[](float t1, float t2) {
+      return t2==-1 ? t1!=-1 : (t1!=-1 && t1<t2);
+    });
+  }
+  return _variants.size()-1;
+}
 
-  if (symIdBound==oldSize) {
-    return;
+bool SineMultiSelector::findVariant(float tolerance, unsigned depthLimit, unsigned& idx)
+{
+  CALL("SineMultiSelector::findVariant");
+
+  for (unsigned i=0;i<_variants.size();i++) {
+    if (_variants[i].tolerance==tolerance && _variants[i].depthLimit==depthLimit) {
+      idx=i;
+      return true;
+    }
   }
-  ASS_G(symIdBound, oldSize);
+  return false;
+}
 
-  _gen.expand(symIdBound);
-  _def.expand(symIdBound);
-  for (size_t i=oldSize;i<symIdBound;i++) {
-    _gen[i]=0;
-    _def[i]=0;
+/**
+ * The generality up to which symbols are defined by a unit whose least
+ * general symbol has generality @b leastGenVal, computed as in SineSelector
+ */
+unsigned SineMultiSelector::generalityLimit(unsigned tolIdx, unsigned leastGenVal)
+{
+  float tolerance=_tolerances[tolIdx];
+  if (tolerance==-1.0f) {
+    return UINT_MAX;
   }
+  return static_cast<int>(leastGenVal*tolerance);
 }
 
 /**
- * Connect unit @b u with symbols it defines
+ * Connect unit @b u with symbols it defines under the least tolerance possible
  */
-void SineTheorySelector::updateDefRelation(Unit* u)
+void SineMultiSelector::updateDefRelation(Unit* u)
 {
-  CALL("SineTheorySelector::updateDefRelation");
+  CALL("SineMultiSelector::updateDefRelation");
 
   SymIdIterator sit0=_symExtr.extractSymIds(u);
 
   if (!sit0.hasNext()) {
-
     _unitsWithoutSymbols.push(u);
     return;
   }
@@ -582,14 +611,222 @@ void SineTheorySelector::updateDefRelation(Unit* u)
   symIds.reset();
   symIds.loadFromIterator(sit0);
 
+  unsigned leastGenVal=UINT_MAX;
+  Stack<SymId>::Iterator sit(symIds);
+  while (sit.hasNext()) {
+    unsigned val=_gen[sit.next()];
+    ASS_G(val,0);
+    if (val<leastGenVal) {
+      leastGenVal=val;
+    }
+  }
+
+  Stack<SymId>::Iterator sit2(symIds);
+  while (sit2.hasNext()) {
+    SymId sym=sit2.next();
+    unsigned val=_gen[sym];
+
+    if (val<=_genThreshold) {
+      DEntryList::push(DEntry(0,u),_def[sym]);
+      continue;
+    }
+    for (unsigned i=0;i<_tolerances.size();i++) {
+      if (val<=generalityLimit(i,leastGenVal)) {
+        DEntryList::push(DEntry(i,u),_def[sym]);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * Compute the selections of all the registered variants for the problem
+ * consisting of @b units
+ */
+void SineMultiSelector::perform(UnitList* units)
+{
+  CALL("SineMultiSelector::perform");
+
+  TIME_TRACE(TimeTrace::SINE_SELECTION);
+
+  initGeneralityFunction(units);
+
+  SymId symIdBound=_symExtr.getSymIdBound();
+
+  Stack<Unit*> goals;
+
+  _def.init(symIdBound,0);
+  _unitCount=0;
+  UnitList::Iterator uit(units);
+  while (uit.hasNext()) {
+    _unitCount++;
+    Unit* u=uit.next();
+    bool performSelection= _onIncluded ? u->included() : ((u->inputType()==UnitInputType::AXIOM)
+                            || (env.options->guessTheGoal() != Options::GoalGuess::OFF && u->inputType()==UnitInputType::ASSUMPTION));
+    if (performSelection) {
+      updateDefRelation(u);
+    }
+    else {
+      goals.push(u);
+    }
+  }
+
+  _selected.ensure(_tolerances.size());
+  _depthEnds.ensure(_tolerances.size());
+  for (unsigned i=0;i<_tolerances.size();i++) {
+    select(i,goals);
+  }
+
+  for (unsigned i=0;i<_variants.size();i++) {
+    while (_tolerances[_variants[i].tolIdx]!=_variants[i].tolerance) {
+      _variants[i].tolIdx++;
+    }
+  }
+
+  DArray<DEntryList*>::Iterator dit(_def);
+  while (dit.hasNext()) {
+    DEntryList::destroy(dit.next());
+  }
+  _def.init(0,0);
+}
+
+/**
+ * Run the selection for the tolerance with index @b tolIdx without a depth limit,
+ * recording the order of selection and the number of units selected up to each depth
+ */
+void SineMultiSelector::select(unsigned tolIdx, Stack<Unit*>& goals)
+{
+  CALL("SineMultiSelector::select");
+
+  Stack<Unit*>& selectedStack=_selected[tolIdx];
+  Stack<unsigned>& depthEnds=_depthEnds[tolIdx];
+
+  DHSet<Unit*> selected;
+  DArray<bool> symbolDone;
+  symbolDone.init(_def.size(),false);
+
+  Stack<Unit*>::BottomFirstIterator git(goals);
+  while (git.hasNext()) {
+    Unit* u=git.next();
+    selected.insert(u);
+    selectedStack.push(u);
+  }
+  depthEnds.push(selectedStack.size());
+
+  unsigned levelStart=0;
+  while (levelStart<selectedStack.size()) {
+    unsigned levelEnd=selectedStack.size();
+    for (unsigned i=levelStart;i<levelEnd;i++) {
+      SymIdIterator sit=_symExtr.extractSymIds(selectedStack[i]);
+      while (sit.hasNext()) {
+        SymId sym=sit.next();
+        if (symbolDone[sym]) {
+          continue;
+        }
+        symbolDone[sym]=true;
+
+        DEntryList::Iterator defUnits(_def[sym]);
+        while (defUnits.hasNext()) {
+          DEntry de=defUnits.next();
+          if (de.tolIdx>tolIdx || !selected.insert(de.unit)) {
+            continue;
+          }
+          selectedStack.push(de.unit);
+        }
+      }
+    }
+    levelStart=levelEnd;
+    if (levelStart<selectedStack.size()) {
+      depthEnds.push(selectedStack.size());
+    }
+  }
+}
+
+void SineMultiSelector::apply(unsigned idx, Problem& prb)
+{
+  CALL("SineMultiSelector::apply");
+
+  const Variant& v=_variants[idx];
+  const Stack<Unit*>& selectedStack=_selected[v.tolIdx];
+  const Stack<unsigned>& depthEnds=_depthEnds[v.tolIdx];
+
+  // the depth counter of SineSelector ends one above the deepest level reached
+  unsigned depth=depthEnds.size();
+  unsigned cnt=selectedStack.size();
+  if (v.depthLimit && v.depthLimit<depth) {
+    depth=v.depthLimit;
+    cnt=depthEnds[v.depthLimit];
+  }
+
+  env.statistics->sineIterations=depth;
+  env.statistics->selectedBySine=_unitsWithoutSymbols.size() + cnt;
+
+  UnitList*& units=prb.units();
+  UnitList::destroy(units);
+  units=0;
+  UnitList::pushFromIterator(Stack<Unit*>::Iterator(_unitsWithoutSymbols), units);
+  for (unsigned i=cnt;i>0;i--) {
+    UnitList::push(selectedStack[i-1], units);
+  }
+
+  if (_unitCount>env.statistics->selectedBySine) {
+    prb.reportIncompleteTransformation();
+  }
+  prb.invalidateByRemoval();
+}
+
+//////////////////////////////////////
+// SineTheorySelector
+//////////////////////////////////////
+
+SineTheorySelector::SineTheorySelector(const Options& opt)
+: _genThreshold(opt.sineGeneralityThreshold()), _opt(opt)
+{
+  CALL("SineTheorySelector::SineTheorySelector");
+}
+
+/**
+ * Return the generality of @b sym in the theory together with
+ * the problem currently being selected for
+ */
+unsigned SineTheorySelector::generality(SymId sym)
+{
+  // symbols added to the signature after the theory was processed do not occur in it
+  unsigned res = sym<_gen.size() ? _gen[sym] : 0;
+  unsigned problemVal;
+  if (_problemGen.find(sym,problemVal)) {
+    res+=problemVal;
+  }
+  return res;
+}
+
+/**
+ * Add to @b acc the entries connecting unit @b u with symbols it defines
+ *
+ * Return false if @b u contains no symbols.
+ */
+bool SineTheorySelector::collectDefEntries(Unit* u, Stack<DPair>& acc)
+{
+  CALL("SineTheorySelector::collectDefEntries");
+
+  SymIdIterator sit0=_symExtr.extractSymIds(u);
+
+  if (!sit0.hasNext()) {
+    return false;
+  }
+
+  static Stack<SymId> symIds;
+  symIds.reset();
+  symIds.loadFromIterator(sit0);
+
   Stack<SymId>::Iterator sit(symIds);
 
   ALWAYS(sit.hasNext());
-  unsigned leastGenVal=_gen[sit.next()];
+  unsigned leastGenVal=generality(sit.next());
 
   while (sit.hasNext()) {
     SymId sym=sit.next();
-    unsigned val=_gen[sym];
+    unsigned val=generality(sym);
     ASS_G(val,0);
 
     if (val<leastGenVal) {
@@ -602,27 +839,27 @@ void SineTheorySelector::updateDefRelation(Unit* u)
   Stack<SymId>::Iterator sit2(symIds);
   while (sit2.hasNext()) {
     SymId sym=sit2.next();
-    unsigned val=_gen[sym];
+    unsigned val=generality(sym);
 
     if (val<=_genThreshold) {
       //if a symbol fits under _genThreshold, add it into the relation
-      DEntryList::push(DEntry(strictTolerance,u),_def[sym]);
+      acc.push(DPair(sym,DEntry(strictTolerance,u)));
     }
     else if (val<=generalityLimit) {
       unsigned short minTolerance=(val*strictTolerance)/leastGenVal;
       //only if the symbol is over _genThreshold; otherwise it is already added
-      DEntryList::push(DEntry(minTolerance,u),_def[sym]);
+      acc.push(DPair(sym,DEntry(minTolerance,u)));
     }
   }
-
+  return true;
 }
 
 /**
  * Preprocess the theory axioms in @b units, so that some of them can be later
- * selected for a particular problem formulas by the @b addSelectedAxioms() function
+ * selected for a particular problem formulas by the @b perform() function
  *
  * If the value of the sineTolerance and sineDepth options changes after the
- * preprocessing and before the call to the @b addSelectedAxioms function, the
+ * preprocessing and before the call to the @b perform function, the
  * modified values will be used (The preprocessing allows for selection with
  * tolerance values up to the limit implied by the value of @b maxTolerance.)
  */
@@ -633,15 +870,35 @@ void SineTheorySelector::initSelectionStructure(UnitList* units)
   TIME_TRACE(TimeTrace::SINE_SELECTION);
 
   initGeneralityFunction(units);
+  _problemGen.reset();
 
-  SymId symIdBound=_symExtr.getSymIdBound();
-
-  //build the D-relation
-  _def.init(symIdBound,0);
+  //collect the D-relation as pairs first, then lay it out by symbols
+  Stack<DPair> entries;
   UnitList::Iterator uit(units);
   while (uit.hasNext()) {
     Unit* u=uit.next();
-    updateDefRelation(u);
+    if (!collectDefEntries(u,entries)) {
+      _unitsWithoutSymbols.push(u);
+    }
+  }
+
+  SymId symIdBound=_gen.size();
+  _defStart.init(symIdBound+1,0);
+  Stack<DPair>::Iterator eit(entries);
+  while (eit.hasNext()) {
+    _defStart[eit.next().first+1]++;
+  }
+  for (SymId sym=0;sym<symIdBound;sym++) {
+    _defStart[sym+1]+=_defStart[sym];
+  }
+
+  DArray<unsigned> next;
+  next.initFromArray(symIdBound,_defStart);
+  _defEntries.ensure(entries.size());
+  Stack<DPair>::BottomFirstIterator eit2(entries);
+  while (eit2.hasNext()) {
+    const DPair& e=eit2.next();
+    _defEntries[next[e.first]++]=e.second;
   }
 }
 
@@ -652,15 +909,15 @@ void SineTheorySelector::perform(UnitList*& units)
 
   TIME_TRACE(TimeTrace::SINE_SELECTION);
 
-  handlePossibleSignatureChange();
-
+  _problemGen.reset();
   UnitList::Iterator uit(units);
   while (uit.hasNext()) {
     Unit* u=uit.next();
     SymIdIterator sit=_symExtr.extractSymIds(u);
     while (sit.hasNext()) {
-      SymId sid=sit.next();
-      _gen[sid]++;
+      unsigned* pval;
+      _problemGen.getValuePtr(sit.next(),pval,0);
+      (*pval)++;
     }
   }
 
@@ -671,6 +928,11 @@ void SineTheorySelector::perform(UnitList*& units)
 
   bool sineOnIncluded=_opt.sineSelection()==Options::SineSelection::INCLUDED;
 
+  //the D-relation of the axioms of the problem itself is kept aside, so that
+  //the structure built for the theory stays unchanged
+  Stack<DPair> problemEntries;
+  DHMap<SymId,DEntryList*> problemDef;
+
   //build the D-relation and select the non-axiom formulas
   UnitList::Iterator uit2(units);
   while (uit2.hasNext()) {
@@ -678,19 +940,32 @@ void SineTheorySelector::perform(UnitList*& units)
     bool performSelection= sineOnIncluded ? u->included() : ((u->inputType()==UnitInputType::AXIOM)
                    || (env.options->guessTheGoal() != Options::GoalGuess::OFF && u->inputType()==UnitInputType::ASSUMPTION));
 
-    if (performSelection) {
-      updateDefRelation(u);
-    }
-    else {
-      selected.insert(u);
-      newlySelected.push_back(u);
-      UnitList::push(u,res);
+    if (performSelection && collectDefEntries(u,problemEntries)) {
+      continue;
     }
+    //non-axiom formulas and formulas without symbols are always selected
+    selected.insert(u);
+    newlySelected.push_back(u);
+    UnitList::push(u,res);
+  }
+  Stack<DPair>::BottomFirstIterator peit(problemEntries);
+  while (peit.hasNext()) {
+    const DPair& e=peit.next();
+    DEntryList** plst;
+    problemDef.getValuePtr(e.first,plst,0);
+    DEntryList::push(e.second,*plst);
   }
-
 
   unsigned short intTolerance=static_cast<unsigned short>(ceil(_opt.sineTolerance()*10));
 
+  auto select = [&](const DEntry& de) {
+    if (de.minTolerance>intTolerance || !selected.insert(de.unit)) {
+      return;
+    }
+    UnitList::push(de.unit,res);
+    newlySelected.push_back(de.unit);
+  };
+
   unsigned depthLimit=_opt.sineDepth();
   unsigned depth=0;
   newlySelected.push_back(0);
@@ -721,19 +996,29 @@ void SineTheorySelector::perform(UnitList*& units)
 	//we already added units belonging to this symbol
 	continue;
       }
-      DEntryList::Iterator defUnits(_def[sym]);
-      while (defUnits.hasNext()) {
-	DEntry de=defUnits.next();
-
-	if (de.minTolerance>intTolerance || !selected.insert(de.unit)) {
-	  continue;
-	}
-	UnitList::push(de.unit,res);
-	newlySelected.push_back(de.unit);
+      if (sym<_gen.size()) {
+        for (unsigned i=_defStart[sym];i<_defStart[sym+1];i++) {
+          select(_defEntries[i]);
+        }
+      }
+      DEntryList* lst;
+      if (problemDef.find(sym,lst)) {
+        DEntryList::Iterator defUnits(lst);
+        while (defUnits.hasNext()) {
+          select(defUnits.next());
+        }
       }
     }
   }
 
+  DHMap<SymId,DEntryList*>::Iterator pdit(problemDef);
+  while (pdit.hasNext()) {
+    SymId sym;
+    DEntryList* lst;
+    pdit.next(sym,lst);
+    DEntryList::destroy(lst);
+  }
+
   UnitList::pushFromIterator(Stack<Unit*>::Iterator(_unitsWithoutSymbols), res);
 
   UnitList::destroy(units);
@@ -15,9 +15,12 @@
 #ifndef __SineUtils__
 #define __SineUtils__
 
+#include <utility>
+
 #include "Forwards.hpp"
 
 #include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Stack.hpp"
 
 namespace Shell {
@@ -103,17 +106,97 @@ private:
 };
 
 
+/**
+ * Class that computes the SInE axiom selections of a single problem for several
+ * tolerance and depth limit settings at once
+ *
+ * The symbol generalities and the D-relation are computed once, with each entry
+ * labelled by the least of the requested tolerances under which it is present.
+ * One breadth-first selection is then run per distinct tolerance. Its order of
+ * selection is kept, and since the selection under a depth limit is a prefix of
+ * it, the selections for all the depth limits are nested prefixes of one stack.
+ *
+ * The results are the same as those of SineSelector with the corresponding
+ * settings, as long as the problem is not changed in between.
+ */
+class SineMultiSelector
+  : public SineBase
+{
+public:
+  CLASS_NAME(SineMultiSelector);
+  USE_ALLOCATOR(SineMultiSelector);
+
+  SineMultiSelector(bool onIncluded, unsigned genThreshold);
+
+  /** Register a setting and return its index, must be called before @b perform() */
+  unsigned addVariant(float tolerance, unsigned depthLimit);
+  bool findVariant(float tolerance, unsigned depthLimit, unsigned& idx);
+  unsigned variantCount() const { return _variants.size(); }
+
+  void perform(UnitList* units);
+  /** Replace the units of @b prb by the selection of variant @b idx */
+  void apply(unsigned idx, Problem& prb);
+
+  bool onIncluded() const { return _onIncluded; }
+  unsigned genThreshold() const { return _genThreshold; }
+private:
+  struct DEntry
+  {
+    DEntry(unsigned tolIdx, Unit* unit) : tolIdx(tolIdx), unit(unit) {}
+
+    /** index of the least tolerance under which the entry is present */
+    unsigned tolIdx;
+    Unit* unit;
+  };
+  typedef List<DEntry> DEntryList;
+
+  struct Variant
+  {
+    float tolerance;
+    unsigned depthLimit;
+    unsigned tolIdx;
+  };
+
+  unsigned generalityLimit(unsigned tolIdx, unsigned leastGenVal);
+  void updateDefRelation(Unit* u);
+  void select(unsigned tolIdx, Stack<Unit*>& goals);
+
+  bool _onIncluded;
+  unsigned _genThreshold;
+
+  Stack<Variant> _variants;
+  /** The distinct tolerances of the variants, in increasing order (-1 standing for infinity) */
+  Stack<float> _tolerances;
+
+  /** Stored the labelled D-relation */
+  DArray<DEntryList*> _def;
+
+  Stack<Unit*> _unitsWithoutSymbols;
+  unsigned _unitCount;
+
+  /** For each tolerance, the units in the order they were selected */
+  DArray<Stack<Unit*> > _selected;
+  /** For each tolerance, element @b d is the number of units selected up to the depth @b d */
+  DArray<Stack<unsigned> > _depthEnds;
+};
+
 /**
  * Class that can perform the SInE axiom selection for multiple problems
  * sharing the same set of theory axioms
  *
  * First init the selection structure by @b initSelectionStructure() and
- * then select axioms for a particular problem by @b addSelectedAxioms()
+ * then select axioms for a particular problem by @b perform(). The selection
+ * does not modify the structure and only touches the D-relation entries of
+ * the symbols reached, so its cost depends on the size of the selected set
+ * rather than on the size of the theory.
  */
 class SineTheorySelector
 : public SineBase
 {
 public:
+  CLASS_NAME(SineTheorySelector);
+  USE_ALLOCATOR(SineTheorySelector);
+
   SineTheorySelector(const Options& opt);
 
   void initSelectionStructure(UnitList* units);
@@ -128,23 +211,32 @@ private:
   static const unsigned short maxTolerance=50;
   static const unsigned short strictTolerance=10;
 
-  void handlePossibleSignatureChange();
-
-  void updateDefRelation(Unit* u);
-
-  unsigned _genThreshold;
-
   struct DEntry
   {
+    DEntry() {}
     DEntry(unsigned short minTolerance, Unit* unit) : minTolerance(minTolerance), unit(unit) {}
 
     unsigned short minTolerance;
     Unit* unit;
   };
   typedef List<DEntry> DEntryList;
+  typedef std::pair<SymId,DEntry> DPair;
 
-  /** Stored the D-relation */
-  DArray<DEntryList*> _def;
+  unsigned generality(SymId sym);
+  bool collectDefEntries(Unit* u, Stack<DPair>& acc);
+
+  unsigned _genThreshold;
+
+  /**
+   * Stores the D-relation of the theory axioms in the compressed sparse row
+   * format: the entries of symbol @b s are those of @b _defEntries from
+   * @b _defStart[s] up to @b _defStart[s+1]
+   */
+  DArray<unsigned> _defStart;
+  DArray<DEntry> _defEntries;
+
+  /** Generality counts of the problem being selected for, added to those in @b _gen */
+  DHMap<SymId,unsigned> _problemGen;
 
   /**
    * Stored formulas that don't contain any symbols
@@ -95,6 +95,7 @@ Statistics::Statistics()
     inductionApplicationInProof(0),
     generalizedInductionApplication(0),
     generalizedInductionApplicationInProof(0),
+    inductionFormulaReuse(0),
     argumentCongruence(0),
     narrow(0),
     forwardSubVarSup(0),
@@ -121,6 +122,8 @@ Statistics::Statistics()
     forwardLiteralRewrites(0),
     condensations(0),
     globalSubsumption(0),
+    globalSubsumptionCalls(0),
+    globalSubsumptionBudgetExhausted(0),
     interpretedSimplifications(0),
 
     asgViolations(0),
@@ -132,6 +135,11 @@ Statistics::Statistics()
     evaluationIncomp(0),
     evaluationGreater(0),
     evaluationCnt(0),
+    evaluationCacheHits(0),
+    evaluationCacheMisses(0),
+    polyNormalizationCacheHits(0),
+    polyNormalizationCacheMisses(0),
+    combinatorWhnfCacheHits(0),
     innerRewrites(0),
     innerRewritesToEqTaut(0),
     deepEquationalTautologies(0),
@@ -139,6 +147,7 @@ Statistics::Statistics()
     equationalTautologies(0),
     forwardSubsumed(0),
     backwardSubsumed(0),
+    integerBoundSubsumed(0),
     taDistinctnessSimplifications(0),
     taDistinctnessTautologyDeletions(0),
     taInjectivitySimplifications(0),
@@ -162,6 +171,9 @@ Statistics::Statistics()
     satClauses(0),
     unitSatClauses(0),
     binarySatClauses(0),
+    satClauseBytes(0),
+    satClauseArenaPeak(0),
+    satConflicts(0),
 
     satSplits(0),
     satSplitRefutations(0),
@@ -172,8 +184,12 @@ Statistics::Statistics()
     instGenRedundantClauses(0),
     instGenKeptClauses(0),
     instGenIterations(0),
+    fmbSymmetricPredicates(0),
+    fmbPredicateSymmetryChecks(0),
+    fmbPredicateSymmetryClauses(0),
 
     satPureVarsEliminated(0),
+    preprocessingMemory(0),
     terminationReason(UNKNOWN),
     refutation(0),
     saturatedSet(0),
@@ -328,6 +344,9 @@ void Statistics::print(ostream& out)
   COND_OUT("Inner rewrites", innerRewrites);
   COND_OUT("Condensations", condensations);
   COND_OUT("Global subsumptions", globalSubsumption);
+  COND_OUT("Global subsumption solver calls", globalSubsumptionCalls);
+  COND_OUT("Global subsumption success rate [%]", globalSubsumptionCalls ? (100*globalSubsumption)/globalSubsumptionCalls : 0);
+  COND_OUT("Global subsumption calls out of budget", globalSubsumptionBudgetExhausted);
   COND_OUT("Interpreted simplifications", interpretedSimplifications);
 
   COND_OUT("asg count", asgCnt);
@@ -339,13 +358,18 @@ void Statistics::print(ostream& out)
   COND_OUT("Evaluation count",         evaluationCnt);
   COND_OUT("Evaluation results greater than premise", evaluationGreater);
   COND_OUT("Evaluation results incomparable to premise", evaluationIncomp);
+  COND_OUT("Ground evaluation cache hits", evaluationCacheHits);
+  COND_OUT("Ground evaluation cache misses", evaluationCacheMisses);
+  COND_OUT("Polynomial normalization cache hits", polyNormalizationCacheHits);
+  COND_OUT("Polynomial normalization cache misses", polyNormalizationCacheMisses);
+  COND_OUT("Combinator normal form cache hits", combinatorWhnfCacheHits);
   COND_OUT("Logicial proxy rewrites", proxyEliminations);
   COND_OUT("Boolean simplifications", booleanSimps)
   //COND_OUT("Interpreted simplifications", interpretedSimplifications);
   SEPARATOR;
 
   HEADING("Deletion Inferences",simpleTautologies+equationalTautologies+
-      forwardSubsumed+backwardSubsumed+forwardDemodulationsToEqTaut+
+      forwardSubsumed+backwardSubsumed+integerBoundSubsumed+forwardDemodulationsToEqTaut+
       forwardSubsumptionDemodulationsToEqTaut+backwardSubsumptionDemodulationsToEqTaut+
       backwardDemodulationsToEqTaut+innerRewritesToEqTaut);
   COND_OUT("Simple tautologies", simpleTautologies);
@@ -353,6 +377,7 @@ void Statistics::print(ostream& out)
   COND_OUT("Deep equational tautologies", deepEquationalTautologies);
   COND_OUT("Forward subsumptions", forwardSubsumed);
   COND_OUT("Backward subsumptions", backwardSubsumed);
+  COND_OUT("Integer bound subsumptions", integerBoundSubsumed);
   COND_OUT("Fw demodulations to eq. taut.", forwardDemodulationsToEqTaut);
   COND_OUT("Bw demodulations to eq. taut.", backwardDemodulationsToEqTaut);
   COND_OUT("Fw subsumption demodulations to eq. taut.", forwardSubsumptionDemodulationsToEqTaut);
@@ -411,6 +436,7 @@ void Statistics::print(ostream& out)
   COND_OUT("InductionApplicationsInProof",inductionApplicationInProof);
   COND_OUT("GeneralizedInductionApplications",generalizedInductionApplication);
   COND_OUT("GeneralizedInductionApplicationsInProof",generalizedInductionApplicationInProof);
+  COND_OUT("InductionFormulaReuses",inductionFormulaReuse);
   COND_OUT("Argument congruence", argumentCongruence);
   COND_OUT("Negative extensionality", negativeExtensionality);
   COND_OUT("Primitive substitutions", primitiveInstantiations);
@@ -449,18 +475,26 @@ void Statistics::print(ostream& out)
   COND_OUT("InstGen iterations", instGenIterations);
   SEPARATOR;
 
-  //TODO record statistics for FMB
+  HEADING("Finite Model Building",fmbSymmetricPredicates+fmbPredicateSymmetryChecks);
+  COND_OUT("FMB symmetric predicates", fmbSymmetricPredicates);
+  COND_OUT("FMB predicate symmetry checks", fmbPredicateSymmetryChecks);
+  COND_OUT("FMB predicate symmetry clauses", fmbPredicateSymmetryClauses);
+  SEPARATOR;
 
   //TODO record statistics for MiniSAT
   HEADING("SAT Solver Statistics",satClauses+unitSatClauses+binarySatClauses+satPureVarsEliminated);
   COND_OUT("SAT solver clauses", satClauses);
   COND_OUT("SAT solver unit clauses", unitSatClauses);
   COND_OUT("SAT solver binary clauses", binarySatClauses);
+  COND_OUT("SAT solver bytes per clause", satClauses ? satClauseBytes/satClauses : 0);
+  COND_OUT("SAT solver clause memory peak [KB]", satClauseArenaPeak/1024);
+  COND_OUT("SAT solver conflicts", satConflicts);
   COND_OUT("Pure propositional variables eliminated by SAT solver", satPureVarsEliminated);
   SEPARATOR;
 
   }
 
+  COND_OUT("Memory used after preprocessing [KB]", preprocessingMemory/1024);
   COND_OUT("Memory used [KB]", Allocator::getUsedMemory()/1024);
 
   addCommentSignForSZS(out);
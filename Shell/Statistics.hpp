@@ -150,6 +150,8 @@ public:
   unsigned inductionApplicationInProof;
   unsigned generalizedInductionApplication;
   unsigned generalizedInductionApplicationInProof;
+  /** number of induction contexts whose formulas were found in the induction formula index */
+  unsigned inductionFormulaReuse;
   /** number of argument congruences */
   unsigned argumentCongruence;
   unsigned narrow;
@@ -194,6 +196,10 @@ public:
   unsigned condensations;
   /** number of global subsumptions */
   unsigned globalSubsumption;
+  /** number of SAT solver calls made by global subsumption */
+  unsigned globalSubsumptionCalls;
+  /** number of global subsumption calls that ran out of their conflict budget */
+  unsigned globalSubsumptionBudgetExhausted;
   /** number of interpreted simplifications */
   unsigned interpretedSimplifications;
 
@@ -213,6 +219,16 @@ public:
   unsigned evaluationGreater;
   /** number of simplifications by PolynomialNormalizer */
   unsigned evaluationCnt;
+  /** number of ground literals whose evaluation result was cached */
+  unsigned evaluationCacheHits;
+  /** number of ground literals evaluated because their result was not cached */
+  unsigned evaluationCacheMisses;
+  /** number of terms whose normal form was found in the polynomial normalization cache */
+  unsigned polyNormalizationCacheHits;
+  /** number of terms that had to be normalized because their normal form was not cached */
+  unsigned polyNormalizationCacheMisses;
+  /** number of terms whose weak-head normal form was found in the combinator demodulation cache */
+  unsigned combinatorWhnfCacheHits;
 
   /** number of (proper) inner rewrites */
   unsigned innerRewrites;
@@ -230,6 +246,8 @@ public:
   unsigned forwardSubsumed;
   /** number of backward subsumed clauses */
   unsigned backwardSubsumed;
+  /** number of clauses deleted because a literal was implied by an integer bound */
+  unsigned integerBoundSubsumed;
 
   /** statistics of term algebra rules */
   unsigned taDistinctnessSimplifications;
@@ -275,6 +293,12 @@ public:
   unsigned unitSatClauses;
   /** Number of binary clauses generated for the SAT solver */
   unsigned binarySatClauses;
+  /** Total number of bytes allocated for clauses of the SAT solver */
+  size_t satClauseBytes;
+  /** Maximal amount of memory held by the SATClauseArena (in bytes) */
+  size_t satClauseArenaPeak;
+  /** Number of conflicts encountered by the minisat solvers */
+  unsigned long satConflicts;
 
   unsigned satSplits;
   unsigned satSplitRefutations;
@@ -286,9 +310,19 @@ public:
   unsigned instGenKeptClauses;
   unsigned instGenIterations;
 
+  /** Number of predicates found interchangeable with another one by FMB */
+  unsigned fmbSymmetricPredicates;
+  /** Number of clause mappings done while looking for interchangeable predicates */
+  unsigned fmbPredicateSymmetryChecks;
+  /** Number of lex-leader clauses added for interchangeable predicates */
+  unsigned fmbPredicateSymmetryClauses;
+
   /** Number of pure variables eliminated by SAT solver */
   unsigned satPureVarsEliminated;
 
+  /** Memory used when preprocessing finished (in bytes), i.e. its peak during preprocessing */
+  size_t preprocessingMemory;
+
   /** termination reason */
   enum TerminationReason {
     /** refutation found */
@@ -30,6 +30,7 @@
 #include "Kernel/Problem.hpp"
 #include "Kernel/FormulaUnit.hpp"
 
+#include "Parse/BinaryClauses.hpp"
 #include "Parse/SMTLIB2.hpp"
 #include "Parse/TPTP.hpp"
 
@@ -211,11 +212,21 @@ UnitList* UIHelper::tryParseSMTLIB2(const Options& opts,istream* input,SMTLIBLog
           return parser.getFormulas();
 }
 
+/**
+ * True if the attempts to parse the input may be reported on the output.
+ * They may not in the spider mode, nor when the output is a binary clause file.
+ */
+static bool reportParsingAttempts()
+{
+  return env.options->mode()!=Options::Mode::SPIDER &&
+    env.options->binaryOutput()==Options::BinaryOutput::OFF;
+}
+
 // Call this function to report a parsing attempt has failed and to reset the input
 template<typename T>
 void resetParsing(T exception, vstring inputFile, istream*& input,vstring nowtry)
 {
-  if (env.options->mode()!=Options::Mode::SPIDER) {
+  if (reportParsingAttempts()) {
     env.beginOutput();
     addCommentSignForSZS(env.out());
     env.out() << "Failed with\n";
@@ -269,7 +280,7 @@ Problem* UIHelper::getInputProblem(const Options& opts)
        bool smtlib = hasEnding(inputFile,"smt") || hasEnding(inputFile,"smt2");
 
        if(smtlib){
-         if (env.options->mode()!=Options::Mode::SPIDER) {
+         if (reportParsingAttempts()) {
            env.beginOutput();
            addCommentSignForSZS(env.out());
            env.out() << "Running in auto input_syntax mode. Trying SMTLIB2\n";
@@ -293,7 +304,7 @@ Problem* UIHelper::getInputProblem(const Options& opts)
 
        }
        else{
-         if (env.options->mode()!=Options::Mode::SPIDER) {
+         if (reportParsingAttempts()) {
            env.beginOutput();
            addCommentSignForSZS(env.out());
            env.out() << "Running in auto input_syntax mode. Trying TPTP\n";
@@ -316,6 +327,9 @@ Problem* UIHelper::getInputProblem(const Options& opts)
   case Options::InputSyntax::SMTLIB2:
     units = tryParseSMTLIB2(opts,input,smtLibLogic);
     break;
+  case Options::InputSyntax::BINARY:
+    units = Parse::BinaryClauses::read(*input,s_haveConjecture);
+    break;
   }
   if (inputFile!="") {
     BYPASSING_ALLOCATOR;
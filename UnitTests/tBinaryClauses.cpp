@@ -0,0 +1,116 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/VString.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Parse/BinaryClauses.hpp"
+#include "Parse/TPTP.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace Parse;
+using namespace Test;
+
+#define MY_SYNTAX_SUGAR                                                                                       \
+  NUMBER_SUGAR(Int)                                                                                           \
+  DECL_DEFAULT_VARS                                                                                           \
+  DECL_CONST(a, Int)                                                                                          \
+  DECL_FUNC(f, {Int}, Int)                                                                                    \
+  DECL_PRED(p, {Int})                                                                                         \
+
+/**
+ * Write @b clauses in the binary format and read them back.
+ */
+UnitList* roundTrip(const Stack<Clause*>& clauses, bool numbers, bool& haveConjecture)
+{
+  vstringstream str;
+  BinaryClauses::write(str, clauses, numbers);
+  return BinaryClauses::read(str, haveConjecture);
+}
+
+/**
+ * Check that @b units are the clauses @b clauses. Terms are shared and
+ * the symbols are read into the same signature, so the read literals
+ * must be the very same objects.
+ */
+void checkSameClauses(const Stack<Clause*>& clauses, UnitList* units)
+{
+  ASS_EQ(UnitList::length(units), clauses.size());
+  UnitList::Iterator it(units);
+  for (unsigned i = 0; i < clauses.size(); i++) {
+    Clause* cl = clauses[i];
+    Unit* u = it.next();
+    ASS(u->isClause());
+    Clause* read = u->asClause();
+    ASS_EQ(read->length(), cl->length());
+    ASS(read->inputType() == cl->inputType());
+    for (unsigned j = 0; j < cl->length(); j++) {
+      ASS_EQ((*read)[j], (*cl)[j]);
+    }
+  }
+}
+
+TEST_FUN(binary_round_trip)
+{
+  MY_SYNTAX_SUGAR
+
+  Stack<Clause*> clauses;
+  clauses.push(clause({ p(f(x)), ~p(a) }));
+  clauses.push(clause({ f(x) == x + 1, x < num(-3) }));
+  clauses.push(clause({ a != f(f(y)), p(x * y) }));
+  clauses.push(clause({}));
+
+  bool haveConjecture;
+  UnitList* units = roundTrip(clauses, false, haveConjecture);
+  checkSameClauses(clauses, units);
+  ASS(!haveConjecture);
+}
+
+TEST_FUN(binary_round_trip_numbered)
+{
+  MY_SYNTAX_SUGAR
+
+  Stack<Clause*> clauses;
+  clauses.push(clause({ p(a) }));
+  clauses.push(clause({ ~p(f(a)), a == num(7) }));
+  clauses.top()->inference().setInputType(UnitInputType::NEGATED_CONJECTURE);
+
+  bool haveConjecture;
+  UnitList* units = roundTrip(clauses, true, haveConjecture);
+  checkSameClauses(clauses, units);
+  ASS(haveConjecture);
+
+  // clause numbers become the names of the read clauses
+  UnitList::Iterator it(units);
+  for (unsigned i = 0; i < clauses.size(); i++) {
+    vstring name;
+    ASS(TPTP::findAxiomName(it.next(), name));
+    ASS_EQ(name, Int::toString(clauses[i]->number()));
+  }
+}
+
+TEST_FUN(binary_not_a_clause_file)
+{
+  vstringstream str;
+  str << "fof(a,axiom,p).";
+  bool haveConjecture;
+  try {
+    BinaryClauses::read(str, haveConjecture);
+    ASSERTION_VIOLATION
+  } catch (UserErrorException&) {
+    /* the magic is missing */
+  }
+}
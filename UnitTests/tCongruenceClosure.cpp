@@ -0,0 +1,113 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "DP/SimpleCongruenceClosure.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace Test;
+using namespace DP;
+
+#define CC_SUGAR                                                                                              \
+  DECL_SORT(s)                                                                                                \
+  DECL_CONST(a, s)                                                                                            \
+  DECL_CONST(b, s)                                                                                            \
+  DECL_CONST(c, s)                                                                                            \
+  DECL_FUNC(f, {s}, s)                                                                                        \
+
+TEST_FUN(cc_push_pop)
+{
+  CC_SUGAR
+  SimpleCongruenceClosure cc(nullptr);
+
+  cc.addLiteral(f(a) != f(b));
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  cc.push();
+  cc.addLiteral(a == c);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  cc.push();
+  cc.addLiteral(c == b);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+  LiteralStack core;
+  cc.getUnsatCore(core, 0);
+  ASS_EQ(core.size(), 3);
+
+  cc.pop();
+  ASS_EQ(cc.level(), 1);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  cc.push();
+  cc.addLiteral(b == c);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+
+  cc.pop();
+  cc.pop();
+  cc.push();
+  cc.addLiteral(b == c);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+}
+
+TEST_FUN(cc_new_terms_after_merge)
+{
+  CC_SUGAR
+  DECL_FUNC(g, {s, s}, s)
+  SimpleCongruenceClosure cc(nullptr);
+
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  // the terms are only created after a and b have been merged
+  cc.push();
+  cc.addLiteral(g(f(a), c) != g(f(b), c));
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+  cc.pop();
+
+  cc.reset();
+  cc.addLiteral(g(f(a), c) != g(f(b), c));
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  // the terms are known, but were not asserted since the reset
+  cc.push();
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+}
+
+TEST_FUN(cc_predicates_backtracking)
+{
+  CC_SUGAR
+  DECL_PRED(p, {s})
+  SimpleCongruenceClosure cc(nullptr);
+
+  cc.addLiteral(p(f(a)));
+  cc.push();
+  cc.addLiteral(~p(f(b)));
+  cc.push();
+  cc.addLiteral(f(a) == c);
+  cc.push();
+  cc.addLiteral(c == f(b));
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+
+  cc.pop();
+  cc.pop();
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::SATISFIABLE);
+
+  cc.push();
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), DecisionProcedure::UNSATISFIABLE);
+  LiteralStack core;
+  cc.getUnsatCore(core, 0);
+  ASS_EQ(core.size(), 3);
+}
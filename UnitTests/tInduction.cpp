@@ -30,6 +30,21 @@ using namespace Test::Generation;
 #define SKOLEM_VAR_MIN 100
 #define DECL_SKOLEM_VAR(x, i) DECL_VAR(x, i+SKOLEM_VAR_MIN)
 
+/**
+ * Nullary predicates standing for the fresh Skolem predicates of the
+ * generated clauses, they are matched like the "Skolem" variables
+ */
+unordered_set<unsigned> skolemPredicatePatterns;
+
+Lit skolemPredicatePattern(const char* name) {
+  unsigned pred = env.signature->addPredicate(name, 0);
+  env.signature->getPredicate(pred)->setType(OperatorType::getPredicateType(0));
+  skolemPredicatePatterns.insert(pred);
+  return Literal::create(pred, 0, true, false, nullptr);
+}
+
+#define DECL_SKOLEM_PRED(p) auto p = skolemPredicatePattern(#p);
+
 LiteralIndex* comparisonIndex() {
   return new UnitIntegerComparisonLiteralIndex(new LiteralSubstitutionTree());
 }
@@ -46,6 +61,19 @@ Stack<Index*> getIndices() {
   return { comparisonIndex(), intInductionIndex(), structInductionIndex() };
 }
 
+/**
+ * The number of slot predicates of the induction templates in the signature
+ */
+unsigned slotPredicates() {
+  unsigned res = 0;
+  for (unsigned i = 0; i < env.signature->predicates(); i++) {
+    if (env.signature->predicateName(i).find("ind_slot") == 0) {
+      res++;
+    }
+  }
+  return res;
+}
+
 inline Clause* fromInduction(Clause* cl) {
   cl->inference().setInductionDepth(1);
   return cl;
@@ -108,6 +136,13 @@ public:
         _btd.backtrack();
         return false;
       }
+      if (skolemPredicatePatterns.count(r->functor())) {
+        if (matchSkolemPredicate(l->functor(), r->functor())) {
+          return true;
+        }
+        _btd.backtrack();
+        return false;
+      }
       VList::Iterator vit(r->freeVariables());
       while (vit.hasNext()) {
         auto v = vit.next();
@@ -149,6 +184,28 @@ public:
   }
 
 private:
+  /**
+   * Match the Skolem predicate pattern @b pattern with the predicate @b pred,
+   * the patterns have to be mapped bijectively to nullary Skolem predicates
+   */
+  bool matchSkolemPredicate(unsigned pred, unsigned pattern) {
+    auto it = _predsMatched.find(pattern);
+    if (it != _predsMatched.end()) {
+      return it->second == pred;
+    }
+    if (env.signature->predicateArity(pred) || !env.signature->getPredicate(pred)->skolem()) {
+      return false;
+    }
+    for (const auto& kv : _predsMatched) {
+      if (kv.second == pred) {
+        return false;
+      }
+    }
+    _btd.addBacktrackObject(new MatchedPredBacktrackObject(_predsMatched, pattern));
+    _predsMatched.insert(make_pair(pattern, pred));
+    return true;
+  }
+
   bool matchAftercheck() {
     DHMap<TermList, unsigned> inverse;
     for (const auto& i : _varsMatched) {
@@ -178,6 +235,7 @@ private:
 
   Kernel::RobSubstitution _subst;
   unordered_set<unsigned> _varsMatched;
+  unordered_map<unsigned,unsigned> _predsMatched;
   BacktrackData _btd;
 
   class MatchedVarBacktrackObject : public BacktrackObject {
@@ -190,6 +248,17 @@ private:
     unordered_set<unsigned>& _s;
     unsigned _i;
   };
+
+  class MatchedPredBacktrackObject : public BacktrackObject {
+  public:
+    MatchedPredBacktrackObject(unordered_map<unsigned,unsigned>& m, unsigned i) : _m(m), _i(i) {}
+    void backtrack() override {
+      _m.erase(_i);
+    }
+  private:
+    unordered_map<unsigned,unsigned>& _m;
+    unsigned _i;
+  };
 };
 
 #define TEST_GENERATION_INDUCTION(name, expr)                                                                 \
@@ -886,6 +955,8 @@ TEST_GENERATION_INDUCTION(test_26,
         clause({ f(skx10,skx11) != g(b), f(x4,x5) == g(skx12) }),
         clause({ f(skx10,skx11) != g(b), f(skx13,skx14) != g(r(skx12)) }),
       })
+      // squashed Skolems need the full clausification of each hypothesis
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 0) })
     )
 
 // all skolems are replaced when the hypothesis strengthening options is on, sik=two
@@ -908,6 +979,7 @@ TEST_GENERATION_INDUCTION(test_27,
         clause({ skx6 != r(r0(skx6)), f(x4,x5) == g(r0(skx6)) }),
         clause({ f(skx7,skx8) != g(skx6) }),
       })
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 0) })
     )
 
 // multi-clause use case 1 (induction depth 0)
@@ -1064,6 +1136,9 @@ TEST_GENERATION_INDUCTION(test_32,
         clause({ ~p(b), p(skx0) }),
         clause({ ~p(b), ~p(r(skx0)) }),
       })
+      // the complementary atoms of the multi-clause context need the full
+      // clausification, only the single slot of the given clause is created
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 1) })
     )
 
 // multi-clause generalized occurrences
@@ -1116,6 +1191,122 @@ TEST_GENERATION_INDUCTION(test_33,
       })
     )
 
+// the clauses of the second context of a shape are instantiated from the
+// template built for the first one, the slot predicates of the shapes are shared
+TEST_GENERATION_INDUCTION(test_34,
+    Generation::TestCase()
+      .options({ { "induction", "struct" }, { "non_unit_induction", "on" } })
+      .context({ clause({ ~p1(f(sK2,sK1)) }) })
+      .indices(getIndices())
+      .input( clause({ ~p(f(sK1,sK2)) }) )
+      .expected({
+        // sK2 single literal
+        clause({ ~p(f(b,sK2)), p(f(skx0,sK2)) }),
+        clause({ ~p(f(b,sK2)), ~p(f(r(skx0),sK2)) }),
+
+        // sK1 single literal
+        clause({ ~p(f(sK1,b)), p(f(sK1,skx1)) }),
+        clause({ ~p(f(sK1,b)), ~p(f(sK1,r(skx1))) }),
+
+        // sK2 multiple literals
+        clause({ ~p(f(b,sK2)), p(f(skx2,sK2)), p1(f(sK2,skx2)) }),
+        clause({ ~p(f(b,sK2)), ~p(f(r(skx2),sK2)) }),
+        clause({ ~p(f(b,sK2)), ~p1(f(sK2,r(skx2))) }),
+        clause({ ~p1(f(sK2,b)), p(f(skx2,sK2)), p1(f(sK2,skx2)) }),
+        clause({ ~p1(f(sK2,b)), ~p(f(r(skx2),sK2)) }),
+        clause({ ~p1(f(sK2,b)), ~p1(f(sK2,r(skx2))) }),
+
+        // sK1 multiple literals
+        clause({ ~p(f(sK1,b)), p(f(sK1,skx3)), p1(f(skx3,sK1)) }),
+        clause({ ~p(f(sK1,b)), ~p(f(sK1,r(skx3))) }),
+        clause({ ~p(f(sK1,b)), ~p1(f(r(skx3),sK1)) }),
+        clause({ ~p1(f(b,sK1)), p(f(sK1,skx3)), p1(f(skx3,sK1)) }),
+        clause({ ~p1(f(b,sK1)), ~p(f(sK1,r(skx3))) }),
+        clause({ ~p1(f(b,sK1)), ~p1(f(r(skx3),sK1)) }),
+      })
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 2) })
+    )
+
+// the same as test_34, skolem_reuse needs the full clausification of each hypothesis
+TEST_GENERATION_INDUCTION(test_35,
+    Generation::TestCase()
+      .options({ { "induction", "struct" }, { "non_unit_induction", "on" }, { "skolem_reuse", "on" } })
+      .context({ clause({ ~p1(f(sK2,sK1)) }) })
+      .indices(getIndices())
+      .input( clause({ ~p(f(sK1,sK2)) }) )
+      .expected({
+        // sK2 single literal
+        clause({ ~p(f(b,sK2)), p(f(skx0,sK2)) }),
+        clause({ ~p(f(b,sK2)), ~p(f(r(skx0),sK2)) }),
+
+        // sK1 single literal
+        clause({ ~p(f(sK1,b)), p(f(sK1,skx1)) }),
+        clause({ ~p(f(sK1,b)), ~p(f(sK1,r(skx1))) }),
+
+        // sK2 multiple literals
+        clause({ ~p(f(b,sK2)), p(f(skx2,sK2)), p1(f(sK2,skx2)) }),
+        clause({ ~p(f(b,sK2)), ~p(f(r(skx2),sK2)) }),
+        clause({ ~p(f(b,sK2)), ~p1(f(sK2,r(skx2))) }),
+        clause({ ~p1(f(sK2,b)), p(f(skx2,sK2)), p1(f(sK2,skx2)) }),
+        clause({ ~p1(f(sK2,b)), ~p(f(r(skx2),sK2)) }),
+        clause({ ~p1(f(sK2,b)), ~p1(f(sK2,r(skx2))) }),
+
+        // sK1 multiple literals
+        clause({ ~p(f(sK1,b)), p(f(sK1,skx3)), p1(f(skx3,sK1)) }),
+        clause({ ~p(f(sK1,b)), ~p(f(sK1,r(skx3))) }),
+        clause({ ~p(f(sK1,b)), ~p1(f(r(skx3),sK1)) }),
+        clause({ ~p1(f(b,sK1)), p(f(sK1,skx3)), p1(f(skx3,sK1)) }),
+        clause({ ~p1(f(b,sK1)), ~p(f(sK1,r(skx3))) }),
+        clause({ ~p1(f(b,sK1)), ~p1(f(r(skx3),sK1)) }),
+      })
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 0) })
+    )
+
+// boolean constructor arguments lead to Skolem predicates, so no template is built
+TEST_FUN(test_36) {
+  GenerationTesterInduction tester;
+  __ALLOW_UNUSED(MY_SYNTAX_SUGAR)
+  SortSugar bools(AtomicSort::boolSort());
+  TermSugar ftrue(TermList(Term::foolTrue()));
+  TermSugar ffalse(TermList(Term::foolFalse()));
+  DECL_SORT(w)
+  DECL_CONST(e, w)
+  DECL_FUNC(c, {bools, w}, w)
+  DECL_PRED(c0, {w})
+  DECL_FUNC(c1, {w}, w)
+  // the destructor of the boolean argument is a predicate, which DECL_TERM_ALGEBRA does not support
+  env.signature->getFunction(e.functor())->markTermAlgebraCons();
+  env.signature->getFunction(c.functor())->markTermAlgebraCons();
+  env.signature->getPredicate(c0.functor())->markTermAlgebraDest();
+  env.signature->getFunction(c1.functor())->markTermAlgebraDest();
+  env.signature->addTermAlgebra(new TermAlgebra(w.sugaredExpr(), {
+    new TermAlgebraConstructor(e.functor(), {}),
+    new TermAlgebraConstructor(c.functor(), { c0.functor(), c1.functor() }) }));
+  DECL_SKOLEM_CONST(sK9, w)
+  DECL_SKOLEM_CONST(sK10, w)
+  DECL_PRED(pw, {w, w})
+  DECL_SKOLEM_PRED(skp0)
+  DECL_SKOLEM_PRED(skp1)
+
+  auto test = Generation::TestCase()
+      .options({ { "induction", "struct" } })
+      .indices(getIndices())
+      .input( clause({ ~pw(sK9,sK10) }) )
+      .expected({
+        // sK9
+        clause({ ~pw(e,sK10), pw(skx0,sK10) }),
+        clause({ ~pw(e,sK10), skp0, ~pw(c(ffalse,skx0),sK10) }),
+        clause({ ~pw(e,sK10), ~skp0, ~pw(c(ftrue,skx0),sK10) }),
+
+        // sK10
+        clause({ ~pw(sK9,e), pw(sK9,skx1) }),
+        clause({ ~pw(sK9,e), skp1, ~pw(sK9,c(ffalse,skx1)) }),
+        clause({ ~pw(sK9,e), ~skp1, ~pw(sK9,c(ftrue,skx1)) }),
+      })
+      .postConditions({ TEST_FN_ASS_EQ(slotPredicates(), 0) });
+  test.run(tester);
+}
+
 // no generalization
 TEST_FUN(generalizations_01) {
   __ALLOW_UNUSED(MY_SYNTAX_SUGAR);
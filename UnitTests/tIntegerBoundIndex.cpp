@@ -0,0 +1,179 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Indexing/IntegerBoundIndex.hpp"
+
+#include "Inferences/IntegerBoundSubsumption.hpp"
+
+#include "Saturation/ClauseContainer.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace Test;
+using namespace Indexing;
+using namespace Inferences;
+using namespace Saturation;
+
+#define INT_SUGAR                                                                                             \
+  NUMBER_SUGAR(Int)                                                                                           \
+  DECL_CONST(a, Int)                                                                                          \
+
+void checkBound(Literal* lit, Term* expectedTerm, int expectedBound, bool expectedUpper)
+{
+  Term* t;
+  IntegerConstantType bound;
+  bool upper;
+  bool extracted = IntegerBoundIndex::extractBound(lit, t, bound, upper);
+  ASS(extracted);
+  ASS_EQ(t, expectedTerm);
+  ASS_EQ(bound, IntegerConstantType(expectedBound));
+  ASS_EQ(upper, expectedUpper);
+}
+
+void checkNoBound(Literal* lit)
+{
+  Term* t;
+  IntegerConstantType bound;
+  bool upper;
+  bool extracted = IntegerBoundIndex::extractBound(lit, t, bound, upper);
+  ASS(!extracted);
+}
+
+TEST_FUN(int_bound_strict)
+{
+  INT_SUGAR
+  checkBound(a < 5, a.sugaredExpr().term(), 4, true);
+  checkBound(5 < a, a.sugaredExpr().term(), 6, false);
+}
+
+TEST_FUN(int_bound_negated)
+{
+  INT_SUGAR
+  DECL_FUNC(f, {Int}, Int)
+  checkBound(~(a < 5), a.sugaredExpr().term(), 5, false);
+  checkBound(~(5 < f(a)), f(a).sugaredExpr().term(), 5, true);
+}
+
+TEST_FUN(int_bound_normalized)
+{
+  INT_SUGAR
+  // 0 < 5 - a
+  checkBound(0 < 5 + -a, a.sugaredExpr().term(), 4, true);
+  // 0 < a - 3
+  checkBound(0 < a + -3, a.sugaredExpr().term(), 4, false);
+}
+
+TEST_FUN(int_bound_factors)
+{
+  INT_SUGAR
+  checkBound(3 * a < 7, a.sugaredExpr().term(), 2, true);
+  checkBound(6 < 2 * a, a.sugaredExpr().term(), 4, false);
+  checkBound(7 < -2 * a, a.sugaredExpr().term(), -4, true);
+}
+
+TEST_FUN(int_bound_none)
+{
+  INT_SUGAR
+  DECL_CONST(b, Int)
+  checkNoBound(a < b);
+  checkNoBound(0 * a < 3);
+  checkNoBound(num(2) < 3);
+}
+
+TEST_FUN(int_bound_index_strongest)
+{
+  INT_SUGAR
+  DECL_CONST(b, Int)
+  DECL_FUNC(f, {Int}, Int)
+  PlainClauseContainer container;
+  IntegerBoundIndex index;
+  index.attachContainer(&container);
+
+  Clause* upper4 = clause({ a < 5 });
+  Clause* upper2 = clause({ a < 3 });
+  Clause* lower0 = clause({ ~(a < 0) });
+  container.add(upper4);
+  container.add(upper2);
+  container.add(lower0);
+  // only unit clauses give bounds
+  container.add(clause({ a < 1, b < 1 }));
+
+  // the smallest upper bound is used
+  ASS_EQ(index.getImplyingClause(a < 4), upper2);
+  ASS_EQ(index.getImplyingClause(a < 3), upper2);
+  ASS(!index.getImplyingClause(a < 2));
+  ASS_EQ(index.getImplyingClause(~(3 < a)), upper2);
+
+  ASS_EQ(index.getImplyingClause(~(a < -1)), lower0);
+  ASS_EQ(index.getImplyingClause(-1 < a), lower0);
+  ASS(!index.getImplyingClause(0 < a));
+
+  ASS(!index.getImplyingClause(f(a) < 4));
+  ASS(!index.getImplyingClause(b < 4));
+}
+
+TEST_FUN(int_bound_index_remove)
+{
+  INT_SUGAR
+  PlainClauseContainer container;
+  IntegerBoundIndex index;
+  index.attachContainer(&container);
+
+  Clause* upper2 = clause({ a < 3 });
+  Clause* upper4 = clause({ a < 5 });
+  container.add(upper2);
+  container.add(upper4);
+  ASS_EQ(index.getImplyingClause(a < 6), upper2);
+
+  container.removedEvent.fire(upper2);
+  ASS_EQ(index.getImplyingClause(a < 6), upper4);
+  ASS(!index.getImplyingClause(a < 4));
+
+  container.removedEvent.fire(upper4);
+  ASS(!index.getImplyingClause(a < 6));
+
+  container.add(upper2);
+  ASS_EQ(index.getImplyingClause(a < 6), upper2);
+}
+
+TEST_FUN(int_bound_subsumption)
+{
+  INT_SUGAR
+  DECL_CONST(b, Int)
+  PlainClauseContainer container;
+  IntegerBoundIndex index;
+  index.attachContainer(&container);
+  IntegerBoundSubsumption rule;
+  rule.setTestIndices({ &index });
+
+  Clause* bound = clause({ a < 3 });
+  container.add(bound);
+
+  Clause* replacement = nullptr;
+  ClauseIterator premises;
+  bool deleted = rule.perform(clause({ b < 0, a < 5 }), replacement, premises);
+  ASS(deleted);
+  ASS(!replacement);
+  ASS(premises.hasNext());
+  ASS_EQ(premises.next(), bound);
+  ASS(!premises.hasNext());
+
+  deleted = rule.perform(clause({ b < 0, a < 2 }), replacement, premises);
+  ASS(!deleted);
+  // the bound clause does not delete itself
+  deleted = rule.perform(bound, replacement, premises);
+  ASS(!deleted);
+}
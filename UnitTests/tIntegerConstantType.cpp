@@ -7,13 +7,16 @@
  * https://vprover.github.io/license.html
  * and in the source directory
  */
+#include <climits>
 #include <iostream>
 #include "Lib/List.hpp"
+#include "Kernel/Theory.hpp"
 
 #include "Test/UnitTesting.hpp"
 
 using namespace std;
 using namespace Lib;
+using namespace Kernel;
 
 TEST_FUN(list_1)
 {
@@ -29,3 +32,74 @@ TEST_FUN(list_1)
   ASS_EQ(lst->head(), 0);
   ASS_ALLOC_TYPE(lst, "List");
 }
+
+static IntegerConstantType big(const char* str)
+{ return IntegerConstantType(vstring(str)); }
+
+TEST_FUN(big_parse_print)
+{
+  ASS_EQ(big("2147483647"), IntegerConstantType(INT_MAX));
+  ASS(big("2147483647").isSmall());
+  ASS(!big("2147483648").isSmall());
+  ASS_EQ(big("-2147483649").toString(), "-2147483649");
+  ASS_EQ(big("000123456789012345678901234567890").toString(), "123456789012345678901234567890");
+  ASS_EQ(big("-1000000000000000000000").toString(), "-1000000000000000000000");
+}
+
+TEST_FUN(big_arithmetic)
+{
+  IntegerConstantType max(INT_MAX);
+  IntegerConstantType min(INT_MIN);
+
+  ASS_EQ(max + 1, big("2147483648"));
+  ASS_EQ(big("2147483648") - 1, max);
+  ASS(!(min - 1).isSmall());
+  ASS_EQ(-min, big("2147483648"));
+  ASS_EQ(min.abs(), big("2147483648"));
+  ASS_EQ(max * max, big("4611686014132420609"));
+  ASS_EQ(big("4611686014132420609") - max * max, 0);
+  ASS_EQ(big("123456789012345678901234567890") * big("-987654321098765432109876543210"),
+         big("-121932631137021795226185032733622923332237463801111263526900"));
+}
+
+TEST_FUN(big_division)
+{
+  auto n = big("-121932631137021795226185032733622923332237463801111263526901");
+  auto d = big("987654321098765432109876543210");
+
+  ASS_EQ(n.quotientT(d), big("-123456789012345678901234567890"));
+  ASS_EQ(n.remainderT(d), -1);
+  ASS_EQ(n.quotientF(d), big("-123456789012345678901234567891"));
+  ASS_EQ(n.quotientE(d), big("-123456789012345678901234567891"));
+  ASS_EQ(n.remainderE(d), d - 1);
+  ASS_EQ(n.quotientE(-d), big("123456789012345678901234567891"));
+  ASS_EQ(big("2147483648").quotientT(IntegerConstantType(2)), 1073741824);
+  ASS(d.divides(d * big("1000000000000")));
+  ASS(!d.divides(d * big("1000000000000") + 1));
+  ASS_EQ(IntegerConstantType::gcd(big("6000000000000"), big("-9000000000000")), big("3000000000000"));
+}
+
+TEST_FUN(big_compare)
+{
+  IntegerConstantType min(INT_MIN);
+
+  ASS(big("2147483648") > INT_MAX);
+  ASS(min - 1 < min);
+  ASS(big("-10000000000") < big("-9999999999"));
+  ASS(big("-10000000000") < 0);
+  ASS(big("10000000000") > big("-10000000000"));
+  ASS_EQ(IntegerConstantType::comparePrecedence(big("10000000000"), min), GREATER);
+  ASS_EQ(IntegerConstantType::comparePrecedence(big("-10000000000"), big("10000000000")), GREATER);
+  ASS_EQ(big("10000000000").hash(), (big("5000000000") * 2).hash());
+}
+
+TEST_FUN(big_rational)
+{
+  RationalConstantType r(big("10000000000"), big("-30000000000"));
+  ASS_EQ(r.numerator(), -1);
+  ASS_EQ(r.denominator(), 3);
+  RationalConstantType s(big("10000000001"), IntegerConstantType(2));
+  ASS_EQ(s.floor(), RationalConstantType(big("5000000000")));
+  ASS_EQ(s.ceiling(), RationalConstantType(big("5000000001")));
+  ASS(s > r);
+}
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/DArray.hpp"
+#include "Lib/List.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "SAT/SATClause.hpp"
+#include "SAT/SATLiteral.hpp"
+
+#include "FMB/PredicateSymmetry.hpp"
+#include "FMB/SortInference.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace SAT;
+using namespace FMB;
+using namespace Test;
+
+/**
+ * Predicates p, q and r are pairwise interchangeable. The predicate u has
+ * the same occurrence profile as them, but swapping it with any of them
+ * changes the problem. The predicate t has a different profile.
+ */
+#define MY_SYNTAX_SUGAR                                                                                       \
+  DECL_DEFAULT_VARS                                                                                           \
+  DECL_SORT(srt)                                                                                              \
+  DECL_CONST(a, srt)                                                                                          \
+  DECL_PRED(p, {srt})                                                                                         \
+  DECL_PRED(q, {srt})                                                                                         \
+  DECL_PRED(r, {srt})                                                                                         \
+  DECL_PRED(u, {srt})                                                                                         \
+  DECL_PRED(t, {srt})                                                                                         \
+  ClauseList* clauses = 0;                                                                                    \
+  ClauseList::push(clause({ p(x), q(x), r(x) }), clauses);                                                    \
+  ClauseList::push(clause({ ~p(x), ~q(x) }), clauses);                                                        \
+  ClauseList::push(clause({ ~q(x), ~r(x) }), clauses);                                                        \
+  ClauseList::push(clause({ ~p(x), ~r(x) }), clauses);                                                        \
+  ClauseList::push(clause({ u(x), t(x) }), clauses);                                                          \
+  ClauseList::push(clause({ ~u(x), t(a) }), clauses);                                                         \
+  ClauseList::push(clause({ ~u(a), ~t(x), t(a) }), clauses);                                                  \
+
+/**
+ * Make @b sig a sorted signature in which all predicates take arguments
+ * of the single sort 0.
+ */
+void initSingleSort(SortedSignature& sig)
+{
+  unsigned preds = env.signature->predicates();
+  sig.predicateSignatures.ensure(preds);
+  for (unsigned pred = 0; pred < preds; pred++) {
+    sig.predicateSignatures[pred].init(env.signature->predicateArity(pred), 0);
+  }
+}
+
+TEST_FUN(predicate_symmetry_orbit)
+{
+  MY_SYNTAX_SUGAR
+  DArray<unsigned> ignored;
+  ignored.init(env.signature->predicates(), 0);
+  SortedSignature sig;
+  initSingleSort(sig);
+
+  PredicateSymmetry symmetry(clauses, 0, ignored, &sig, 1000);
+
+  const Stack<Stack<unsigned>>& orbits = symmetry.orbits();
+  ASS_EQ(orbits.size(), 1);
+  ASS_EQ(orbits[0], Stack<unsigned>({ p.functor(), q.functor(), r.functor() }));
+  ASS_G(symmetry.checksPerformed(), 0);
+  ASS_LE(symmetry.checksPerformed(), 1000);
+}
+
+TEST_FUN(predicate_symmetry_ignored)
+{
+  MY_SYNTAX_SUGAR
+  DArray<unsigned> ignored;
+  ignored.init(env.signature->predicates(), 0);
+  ignored[q.functor()] = 1;
+  SortedSignature sig;
+  initSingleSort(sig);
+
+  PredicateSymmetry symmetry(clauses, 0, ignored, &sig, 1000);
+
+  const Stack<Stack<unsigned>>& orbits = symmetry.orbits();
+  ASS_EQ(orbits.size(), 1);
+  ASS_EQ(orbits[0], Stack<unsigned>({ p.functor(), r.functor() }));
+}
+
+TEST_FUN(predicate_symmetry_budget)
+{
+  MY_SYNTAX_SUGAR
+  DArray<unsigned> ignored;
+  ignored.init(env.signature->predicates(), 0);
+  SortedSignature sig;
+  initSingleSort(sig);
+
+  PredicateSymmetry symmetry(clauses, 0, ignored, &sig, 0);
+
+  ASS_EQ(symmetry.orbits().size(), 0);
+  ASS_EQ(symmetry.checksPerformed(), 0);
+}
+
+/**
+ * Return true if the assignment @b bits satisfies all @b clauses,
+ * variable v is assigned bit v-1.
+ */
+bool satisfies(const SATClauseStack& clauses, unsigned bits)
+{
+  for (SATClause* cl : clauses) {
+    bool sat = false;
+    for (unsigned i = 0; i < cl->length() && !sat; i++) {
+      SATLiteral lit = (*cl)[i];
+      sat = ((bits >> (lit.var()-1)) & 1) == lit.polarity();
+    }
+    if (!sat) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST_FUN(predicate_symmetry_lex_leader)
+{
+  // p_k is the variable 1+k, q_k is 1+len+k and the auxiliary variables follow
+  const unsigned len = 3;
+  SATClauseStack clauses;
+  PredicateSymmetry::lexLeaderClauses(1, 1+len, len, 1+2*len, clauses);
+  ASS_EQ(clauses.size(), 3*len-2);
+
+  for (unsigned pBits = 0; pBits < (1u << len); pBits++) {
+    for (unsigned qBits = 0; qBits < (1u << len); qBits++) {
+      // compare the atoms from position 0, false being smaller than true
+      bool lexLeq = true;
+      for (unsigned k = 0; k < len; k++) {
+        unsigned pk = (pBits >> k) & 1;
+        unsigned qk = (qBits >> k) & 1;
+        if (pk != qk) {
+          lexLeq = pk < qk;
+          break;
+        }
+      }
+      bool satisfiable = false;
+      for (unsigned auxBits = 0; auxBits < (1u << (len-1)) && !satisfiable; auxBits++) {
+        satisfiable = satisfies(clauses, pBits | (qBits << len) | (auxBits << (2*len)));
+      }
+      ASS_EQ(satisfiable, lexLeq);
+    }
+  }
+}
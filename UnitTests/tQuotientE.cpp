@@ -69,14 +69,9 @@ TEST_FUN(check_spec) {
       }
 
       if (bothOK) {
-        // do the math 64 bit
-        long long int I = i;
-        long long int J = j;
-        long long int Q = q.toInner();
-        long long int R = r.toInner();
-
-        ASS_EQ(Q * J + R, I)
-        ASS(0 <= R && R < abs(J))
+        // quotientE(min, -1) does not fit into an int, so do the math with IntegerConstantType
+        ASS_EQ(q * j + r, i)
+        ASS(0 <= r && r < IntegerConstantType(j).abs())
       }
       if (i == std::numeric_limits<int>::max()) {
         break;
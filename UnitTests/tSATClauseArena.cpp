@@ -0,0 +1,77 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/Stack.hpp"
+
+#include "SAT/SATClause.hpp"
+#include "SAT/SATClauseArena.hpp"
+#include "SAT/SATLiteral.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+using namespace SAT;
+
+static SATClause* clauseOfLength(unsigned len)
+{
+  SATLiteralStack lits;
+  for (unsigned i = 1; i <= len; i++) {
+    lits.push(SATLiteral(i, i % 2));
+  }
+  return SATClause::fromStack(lits);
+}
+
+TEST_FUN(refRoundTrip)
+{
+  Stack<SATClause*> cls;
+  for (unsigned i = 0; i < 20000; i++) {
+    cls.push(clauseOfLength(i % 7));
+  }
+  for (unsigned i = 0; i < cls.size(); i++) {
+    SATClause* cl = cls[i];
+    ASS_EQ(SATClause::fromRef(cl->ref()), cl);
+    ASS_EQ(cl->length(), i % 7);
+    for (unsigned j = 0; j < cl->length(); j++) {
+      ASS_EQ((*cl)[j].var(), j + 1);
+    }
+  }
+  for (unsigned i = 0; i < cls.size(); i++) {
+    cls[i]->destroy();
+  }
+}
+
+TEST_FUN(blocksAreRecycled)
+{
+  SATClauseArena* arena = SATClauseArena::instance();
+
+  Stack<SATClause*> cls;
+  for (unsigned round = 0; round < 10; round++) {
+    for (unsigned i = 0; i < 50000; i++) {
+      cls.push(clauseOfLength(3));
+    }
+    while (cls.isNonEmpty()) {
+      cls.pop()->destroy();
+    }
+    ASS_EQ(arena->liveBytes(), 0);
+  }
+  // a single round needs a few megabytes, ten rounds must not need ten times as much
+  ASS_L(arena->peakReservedBytes(), 2 * 50000 * sizeof(SATClause) + (1u << 20));
+}
+
+TEST_FUN(largeClause)
+{
+  SATClause* small = clauseOfLength(2);
+  SATClause* large = clauseOfLength(100000);
+  ASS_EQ(SATClause::fromRef(large->ref()), large);
+  ASS_EQ((*large)[99999].var(), 100000u);
+  large->destroy();
+  ASS_EQ(SATClause::fromRef(small->ref()), small);
+  small->destroy();
+}
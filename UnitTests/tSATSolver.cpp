@@ -8,6 +8,11 @@
  * and in the source directory
  */
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+
 #include "Lib/List.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/Environment.hpp"
@@ -17,9 +22,12 @@
 #include "SAT/SATInference.hpp"
 #include "SAT/SATSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
+#include "SAT/RecordingSolver.hpp"
+#include "SAT/SATTraceReplayer.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
 #include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
 
 using namespace std;
 using namespace Lib;
@@ -142,6 +150,51 @@ TEST_FUN(testProofWithAssums)
   testProofWithAssumptions(s);    
 }
 
+/**
+ * Refute the splitting clause of p(a) | q(a) together with the two
+ * component refutations, as AVATAR does, and collect the first-order
+ * premises of the SAT refutation.
+ */
+void testFOPremises(SATSolver& s)
+{
+  CALL("testFOPremises");
+
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_PRED(p, {srt})
+  DECL_PRED(q, {srt})
+
+  Clause* split = clause({ p(a), q(a) });
+  Clause* noP = clause({ ~p(a) });
+  Clause* noQ = clause({ ~q(a) });
+
+  SATClause* splitS = getClause("AB");
+  splitS->setInference(new FOConversionInference(split));
+  SATClause* noPS = getClause("a");
+  noPS->setInference(new FOConversionInference(noP));
+  SATClause* noQS = getClause("b");
+  noQS->setInference(new FOConversionInference(noQ));
+
+  ensurePrepared(s);
+  s.addClause(splitS);
+  s.addClause(noPS);
+  s.addClause(noQS);
+  ASS_EQ(s.solve(),SATSolver::UNSATISFIABLE);
+
+  UnitList* prems = SATInference::getFOPremises(s.getRefutation());
+  ASS_EQ(UnitList::length(prems),3);
+  ASS(UnitList::member(split,prems));
+  ASS(UnitList::member(noP,prems));
+  ASS(UnitList::member(noQ,prems));
+  UnitList::destroy(prems);
+}
+
+TEST_FUN(testFOPremisesOfRefutation)
+{
+  MinisatInterfacing s(*env.options,true);
+  testFOPremises(s);
+}
+
 void testInterface(SATSolverWithAssumptions &s) {
   ensurePrepared(s);
       
@@ -299,3 +352,61 @@ TEST_FUN(testSolvingUnderAssumptions)
     testAssumptions(sZ3);
   }*/
 }
+
+/**
+ * Return the name of a fresh file in the temporary directory
+ * (not in the working directory) for a SAT trace.
+ */
+vstring tempTraceFile()
+{
+  char name[] = P_tmpdir "/vtest_sat_trace_XXXXXX";
+  int fd = mkstemp(name);
+  ASS_NEQ(fd,-1);
+  close(fd);
+  return name;
+}
+
+/**
+ * Replay the trace @b trace into a fresh solver, delete the trace
+ * file and return the number of replayed solve calls.
+ */
+unsigned replayAndRemove(const vstring& trace)
+{
+  MinisatInterfacing replayed(*env.options,true);
+  SATTraceReplayer replayer(&replayed,&replayed);
+  {
+    BYPASSING_ALLOCATOR;
+    ifstream in(trace.c_str());
+    replayer.replay(in);
+  }
+  remove(trace.c_str());
+  ASS_EQ(replayer.statusMismatches(),0);
+  return replayer.solveCalls();
+}
+
+TEST_FUN(testRecordAndReplay)
+{
+  vstring trace = tempTraceFile();
+  {
+    RecordingSolver s(new MinisatInterfacing(*env.options,true),trace);
+    testInterface(s);
+    testAssumptions(s);
+  }
+  unsigned solveCalls = replayAndRemove(trace);
+  ASS_G(solveCalls,0);
+}
+
+TEST_FUN(testTraceFlushedAfterSolve)
+{
+  vstring trace = tempTraceFile();
+
+  RecordingSolver s(new MinisatInterfacing(*env.options,true),trace);
+  ensurePrepared(s);
+  s.addClause(getClause("ab"));
+  s.addClause(getClause("A"));
+  ASS_EQ(s.solve(UINT_MAX),SATSolver::SATISFIABLE);
+
+  // the recording solver is still alive, so the trace must have been flushed
+  unsigned solveCalls = replayAndRemove(trace);
+  ASS_EQ(solveCalls,1);
+}
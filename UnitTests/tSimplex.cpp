@@ -0,0 +1,100 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "DP/Simplex.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace Test;
+using namespace DP;
+
+#define RAT_SUGAR                                                                                             \
+  NUMBER_SUGAR(Rat)                                                                                           \
+  DECL_CONST(a, Rat)                                                                                          \
+  DECL_CONST(b, Rat)                                                                                          \
+
+DecisionProcedure::Status check(Stack<Literal*> lits, LiteralStack& core)
+{
+  Simplex dp;
+  dp.addLiterals(pvi(LiteralStack::ConstIterator(lits)), false);
+  auto status = dp.getStatus(false);
+  if (status==DecisionProcedure::UNSATISFIABLE) {
+    dp.getUnsatCore(core, 0);
+  }
+  return status;
+}
+
+TEST_FUN(simplex_sat)
+{
+  RAT_SUGAR
+  LiteralStack core;
+  ASS_EQ(check({ a + b < 3, a > 1, b > 1 }, core), DecisionProcedure::SATISFIABLE);
+}
+
+TEST_FUN(simplex_bounds_conflict)
+{
+  RAT_SUGAR
+  Literal* l1 = a < 1;
+  Literal* l2 = a > 2;
+  LiteralStack core;
+  ASS_EQ(check({ l1, b > 0, l2 }, core), DecisionProcedure::UNSATISFIABLE);
+  ASS_EQ(core.size(), 2);
+  ASS(core.find(l1));
+  ASS(core.find(l2));
+}
+
+TEST_FUN(simplex_rows_conflict)
+{
+  RAT_SUGAR
+  DECL_FUNC(f, {Rat}, Rat)
+  Literal* l1 = a + b <= 2;
+  Literal* l2 = a + -b >= 0;
+  Literal* l3 = b > 1;
+  Literal* l4 = f(a) > 5;
+  LiteralStack core;
+  ASS_EQ(check({ l4, l1, l2, l3 }, core), DecisionProcedure::UNSATISFIABLE);
+  ASS_EQ(core.size(), 3);
+  ASS(!core.find(l4));
+}
+
+TEST_FUN(simplex_strict)
+{
+  RAT_SUGAR
+  LiteralStack core;
+  ASS_EQ(check({ a + b <= 2, a >= 1, b >= 1 }, core), DecisionProcedure::SATISFIABLE);
+  ASS_EQ(check({ a + b < 2, a >= 1, b >= 1 }, core), DecisionProcedure::UNSATISFIABLE);
+}
+
+TEST_FUN(simplex_equality)
+{
+  RAT_SUGAR
+  DECL_CONST(c, Rat)
+  LiteralStack core;
+  ASS_EQ(check({ 2 * a == b + c, b == 4, c == 2, a > 3 }, core), DecisionProcedure::UNSATISFIABLE);
+}
+
+TEST_FUN(simplex_disequality_unknown)
+{
+  RAT_SUGAR
+  LiteralStack core;
+  ASS_EQ(check({ a != b, a >= 1 }, core), DecisionProcedure::UNKNOWN);
+}
+
+TEST_FUN(simplex_int_rounding)
+{
+  NUMBER_SUGAR(Int)
+  DECL_CONST(a, Int)
+  LiteralStack core;
+  ASS_EQ(check({ 2 * a > 2, 2 * a < 4 }, core), DecisionProcedure::UNSATISFIABLE);
+}
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/Problem.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/SineUtils.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Shell;
+
+static Clause* axiom(std::initializer_list<Literal*> lits)
+{
+  return Clause::fromStack(Stack<Literal*>(lits),
+      NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+}
+
+static Clause* goal(std::initializer_list<Literal*> lits)
+{
+  return Clause::fromStack(Stack<Literal*>(lits),
+      NonspecificInference0(UnitInputType::NEGATED_CONJECTURE, InferenceRule::INPUT));
+}
+
+TEST_FUN(sameAsSineSelector)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_CONST(c, s)
+  DECL_FUNC(f, {s}, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+  DECL_PRED(r, {s})
+  DECL_PRED(t, {s})
+  DECL_PRED(u, {s})
+
+  UnitList* units = 0;
+  UnitList::push(goal({ ~p(a) }), units);
+  UnitList::push(axiom({ p(x), ~q(x) }), units);
+  UnitList::push(axiom({ q(f(x)), ~r(x) }), units);
+  UnitList::push(axiom({ r(b), t(c) }), units);
+  UnitList::push(axiom({ t(x), u(f(x)), ~q(x) }), units);
+  UnitList::push(axiom({ u(a), u(b), u(c) }), units);
+  UnitList::push(axiom({ r(f(f(c))) }), units);
+  UnitList::push(axiom({ t(a), ~p(b) }), units);
+  UnitList::push(axiom({ f(x) == x }), units);
+  units = UnitList::reverse(units);
+
+  float tolerances[] = { 1.0f, 1.5f, 2.0f, 3.0f, -1.0f };
+  unsigned depths[] = { 0, 1, 2 };
+
+  SineMultiSelector multi(false, 0);
+  for (float tol : tolerances) {
+    for (unsigned depth : depths) {
+      multi.addVariant(tol, depth);
+    }
+  }
+  multi.perform(units);
+
+  for (float tol : tolerances) {
+    for (unsigned depth : depths) {
+      UnitList* expected = UnitList::copy(units);
+      SineSelector(false, tol, depth).perform(expected);
+
+      Problem prb(UnitList::copy(units));
+      unsigned idx;
+      ALWAYS(multi.findVariant(tol, depth, idx));
+      multi.apply(idx, prb);
+
+      auto selected = Stack<Unit*>::fromIterator(UnitList::Iterator(prb.units()));
+      ASS_EQ(selected, Stack<Unit*>::fromIterator(UnitList::Iterator(expected)));
+    }
+  }
+}
+
+/**
+ * A slice with a precomputed SInE selection switches SInE selection off
+ * in its options, the strategy it reports must still be the original one.
+ */
+TEST_FUN(precomputedSelectionKeepsStrategy)
+{
+  vstring strategy = "dis+11_3_nm=64:nwc=1:sd=10:ss=axioms:st=5.0_59";
+
+  Options opt;
+  opt.readFromEncodedOptions(strategy);
+  ASS(opt.sineSelection() == Options::SineSelection::AXIOMS);
+  opt.setSineSelection(Options::SineSelection::OFF);
+  ASS_EQ(opt.testId(), strategy);
+
+  // and decoding the reported strategy gives the SInE selection back
+  Options decoded;
+  decoded.readFromEncodedOptions(opt.testId());
+  ASS(decoded.sineSelection() == Options::SineSelection::AXIOMS);
+  ASS_EQ(decoded.sineTolerance(), 5.0f);
+  ASS_EQ(decoded.sineDepth(), 10u);
+}
@@ -51,6 +51,7 @@
 #include "CASC/PortfolioMode.hpp"
 #include "CASC/CLTBMode.hpp"
 #include "CASC/CLTBModeLearning.hpp"
+#include "CASC/ServerMode.hpp"
 #include "Shell/CommandLine.hpp"
 //#include "Shell/EqualityProxy.hpp"
 #include "Shell/Normalisation.hpp"
@@ -60,6 +61,7 @@
 #include "Shell/Preprocess.hpp"
 #include "Shell/TheoryFinder.hpp"
 #include "Shell/TPTPPrinter.hpp"
+#include "Parse/BinaryClauses.hpp"
 #include "Parse/TPTP.hpp"
 #include "Shell/FOOLElimination.hpp"
 #include "Shell/Statistics.hpp"
@@ -367,10 +369,15 @@ void preprocessMode(bool theory)
   }
   prepro.preprocess(*prb);
 
+  bool binary = env.options->binaryOutput() != Options::BinaryOutput::OFF;
+  Stack<Clause*> binaryClauses;
+
   env.beginOutput();
   //outputSymbolDeclarations also deals with sorts for now
   //UIHelper::outputSortDeclarations(env.out());
-  UIHelper::outputSymbolDeclarations(env.out());
+  if (!binary) {
+    UIHelper::outputSymbolDeclarations(env.out());
+  }
   UnitList::Iterator units(prb->units());
   while (units.hasNext()) {
     Unit* u = units.next();
@@ -380,7 +387,12 @@ void preprocessMode(bool theory)
       }
     }
 
-    if (theory) {
+    if (binary) {
+      if (!u->isClause()) {
+        USER_ERROR("Binary output is only possible if the preprocessed problem is clausal, but it contains "+u->toString());
+      }
+      binaryClauses.push(static_cast<Clause*>(u));
+    } else if (theory) {
       Formula* f = u->getFormula();
 
       // CONJECTURE as inputType is evil, as it cannot occur multiple times
@@ -394,6 +406,9 @@ void preprocessMode(bool theory)
       env.out() << TPTPPrinter::toString(u) << "\n";
     }
   }
+  if (binary) {
+    Parse::BinaryClauses::write(env.out(), binaryClauses, env.options->binaryOutput() == Options::BinaryOutput::NUMBERED);
+  }
   env.endOutput();
 
   if(env.options->latexOutput()!="off"){ outputProblemToLaTeX(prb); }
@@ -559,10 +574,15 @@ void clausifyMode(bool theory)
 
   ScopedPtr<Problem> prb(getPreprocessedProblem());
 
+  bool binary = env.options->binaryOutput() != Options::BinaryOutput::OFF;
+  Stack<Clause*> binaryClauses;
+
   env.beginOutput();
   //outputSymbolDeclarations deals with sorts as well for now
   //UIHelper::outputSortDeclarations(env.out());
-  UIHelper::outputSymbolDeclarations(env.out());
+  if (!binary) {
+    UIHelper::outputSymbolDeclarations(env.out());
+  }
 
   ClauseIterator cit = prb->clauseIterator();
   bool printed_conjecture = false;
@@ -573,7 +593,9 @@ void clausifyMode(bool theory)
       continue;
     }
     printed_conjecture |= cl->inputType() == UnitInputType::CONJECTURE || cl->inputType() == UnitInputType::NEGATED_CONJECTURE;
-    if (theory) {
+    if (binary) {
+      binaryClauses.push(cl);
+    } else if (theory) {
       Formula* f = Formula::fromClause(cl);
 
       // CONJECTURE as inputType is evil, as it cannot occur multiple times
@@ -593,7 +615,14 @@ void clausifyMode(bool theory)
     Clause* c = new(2) Clause(2,NonspecificInference0(UnitInputType::NEGATED_CONJECTURE,InferenceRule::INPUT));
     (*c)[0] = Literal::create(p,0,true,false,0);
     (*c)[1] = Literal::create(p,0,false,false,0);
-    env.out() << TPTPPrinter::toString(c) << "\n";
+    if (binary) {
+      binaryClauses.push(c);
+    } else {
+      env.out() << TPTPPrinter::toString(c) << "\n";
+    }
+  }
+  if (binary) {
+    Parse::BinaryClauses::write(env.out(), binaryClauses, env.options->binaryOutput() == Options::BinaryOutput::NUMBERED);
   }
   env.endOutput();
 
@@ -792,6 +821,11 @@ int main(int argc, char* argv[])
       vampireReturnValue = VAMP_RESULT_STATUS_SUCCESS;
       break;
     }
+    case Options::Mode::SERVER:
+      CASC::ServerMode::perform();
+      vampireReturnValue = VAMP_RESULT_STATUS_SUCCESS;
+      break;
+
     case Options::Mode::MODEL_CHECK:
       modelCheckMode();
       break; 
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file vsat_replay.cpp
+ * Re-runs a SAT solver trace recorded with the option record_sat_trace
+ * against a chosen SAT solver backend and reports the time spent.
+ *
+ * Usage: vsat_replay [minisat|minisat_simp] [buffered] [minimizing] trace_file
+ */
+
+#include <iostream>
+#include <fstream>
+
+#include "Debug/Tracer.hpp"
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/System.hpp"
+#include "Lib/Timer.hpp"
+#include "Lib/VString.hpp"
+
+#include "Shell/Options.hpp"
+
+#include "SAT/BufferedSolver.hpp"
+#include "SAT/MinimizingSolver.hpp"
+#include "SAT/MinisatInterfacing.hpp"
+#include "SAT/MinisatInterfacingNewSimp.hpp"
+#include "SAT/SATTraceReplayer.hpp"
+
+using namespace std;
+using namespace Lib;
+using namespace SAT;
+
+int main(int argc, char* argv[])
+{
+  CALL("main");
+
+  System::registerArgv0(argv[0]);
+  System::setSignalHandlers();
+
+  vstring backend = "minisat";
+  bool buffered = false;
+  bool minimizing = false;
+  vstring traceFile;
+  for (int i = 1; i < argc; i++) {
+    vstring arg = argv[i];
+    if (arg == "minisat" || arg == "minisat_simp") {
+      backend = arg;
+    } else if (arg == "buffered") {
+      buffered = true;
+    } else if (arg == "minimizing") {
+      minimizing = true;
+    } else {
+      traceFile = arg;
+    }
+  }
+  if (traceFile.empty()) {
+    cerr << "usage: " << argv[0] << " [minisat|minisat_simp] [buffered] [minimizing] trace_file" << endl;
+    return 1;
+  }
+
+  try {
+    SATSolverWithAssumptions* withAssumptions;
+    if (backend == "minisat") {
+      withAssumptions = new MinisatInterfacing(*env.options,true);
+    } else {
+      withAssumptions = new MinisatInterfacingNewSimp(*env.options,true);
+    }
+    SATSolver* solver = withAssumptions;
+    // the wrappers hide assumptions, as they do in AVATAR
+    if (buffered) {
+      solver = new BufferedSolver(solver);
+      withAssumptions = 0;
+    }
+    if (minimizing) {
+      solver = new MinimizingSolver(solver);
+      withAssumptions = 0;
+    }
+
+    SATTraceReplayer replayer(solver,withAssumptions);
+    {
+      BYPASSING_ALLOCATOR;
+      ifstream in(traceFile.c_str());
+      if (in.fail()) {
+        USER_ERROR("Cannot open SAT trace file: "+traceFile);
+      }
+      replayer.replay(in);
+    }
+
+    replayer.printStatistics(cout);
+    cout << "Total time: ";
+    Timer::printMSString(cout,env.timer->elapsedMilliseconds());
+    cout << endl;
+
+    delete solver;
+    return replayer.statusMismatches() ? 2 : 0;
+  }
+  catch (UserErrorException& exception) {
+    exception.cry(cerr);
+  }
+  catch (Exception& exception) {
+    exception.cry(cerr);
+  }
+  return 1;
+}